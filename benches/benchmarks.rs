@@ -73,6 +73,23 @@ fn bench_koopman32(c: &mut Criterion) {
     group.finish();
 }
 
+fn bench_koopman64(c: &mut Criterion) {
+    let mut group = c.benchmark_group("Koopman64");
+    fast_config(&mut group);
+
+    for size in [64, 256, 1024, 4096, 16384, 65536].iter() {
+        let data = generate_test_data(*size);
+
+        group.throughput(Throughput::Bytes(*size as u64));
+
+        group.bench_with_input(BenchmarkId::new("checksum", size), &data, |b, data| {
+            b.iter(|| koopman64(black_box(data), 0))
+        });
+    }
+
+    group.finish();
+}
+
 fn bench_koopman8p(c: &mut Criterion) {
     let mut group = c.benchmark_group("Koopman8P");
     fast_config(&mut group);
@@ -124,6 +141,210 @@ fn bench_koopman32p(c: &mut Criterion) {
     group.finish();
 }
 
+#[cfg(feature = "parallel")]
+fn bench_koopman32_parallel(c: &mut Criterion) {
+    let mut group = c.benchmark_group("Koopman32Parallel");
+    fast_config(&mut group);
+
+    for size in [16 * 1024 * 1024, 128 * 1024 * 1024].iter() {
+        let data = generate_test_data(*size);
+
+        group.throughput(Throughput::Bytes(*size as u64));
+
+        group.bench_with_input(BenchmarkId::new("sequential", size), &data, |b, data| {
+            b.iter(|| koopman32(black_box(data), 0))
+        });
+
+        group.bench_with_input(BenchmarkId::new("parallel", size), &data, |b, data| {
+            b.iter(|| koopman32_parallel(black_box(data), 0))
+        });
+    }
+
+    group.finish();
+}
+
+#[cfg(all(feature = "simd", target_arch = "x86_64"))]
+fn bench_simd(c: &mut Criterion) {
+    let mut group = c.benchmark_group("SIMD");
+    fast_config(&mut group);
+
+    // The default entry points dispatch to AVX2 on their own now, so the
+    // scalar side of the comparison pins the scalar kernel
+    override_kernel(Kernel::Scalar);
+
+    // Sizes bracket the scalar/vector crossover (see simd::SIMD_THRESHOLD)
+    for size in [64, 128, 256, 1024, 4096, 65536, 1048576].iter() {
+        let data = generate_test_data(*size);
+
+        group.throughput(Throughput::Bytes(*size as u64));
+
+        group.bench_with_input(BenchmarkId::new("koopman32_scalar", size), &data, |b, data| {
+            b.iter(|| koopman32(black_box(data), 0))
+        });
+        group.bench_with_input(BenchmarkId::new("koopman32_avx2", size), &data, |b, data| {
+            b.iter(|| simd::koopman32(black_box(data), 0).unwrap())
+        });
+        group.bench_with_input(BenchmarkId::new("koopman16_scalar", size), &data, |b, data| {
+            b.iter(|| koopman16(black_box(data), 0))
+        });
+        group.bench_with_input(BenchmarkId::new("koopman16_avx2", size), &data, |b, data| {
+            b.iter(|| simd::koopman16(black_box(data), 0).unwrap())
+        });
+    }
+
+    // Back to automatic selection for the groups that follow
+    override_kernel(Kernel::Avx2);
+
+    group.finish();
+}
+
+fn bench_custom_modulus(c: &mut Criterion) {
+    use std::num::{NonZeroU32, NonZeroU64};
+
+    let mut group = c.benchmark_group("CustomModulus");
+    fast_config(&mut group);
+
+    // Non-default moduli exercise the generic reduction path
+    let m16 = NonZeroU32::new(32749).unwrap();
+    let m32 = NonZeroU64::new(2147483629).unwrap();
+
+    for size in [1024, 65536].iter() {
+        let data = generate_test_data(*size);
+
+        group.throughput(Throughput::Bytes(*size as u64));
+
+        group.bench_with_input(BenchmarkId::new("koopman16", size), &data, |b, data| {
+            b.iter(|| koopman16_with_modulus(black_box(data), 0, m16))
+        });
+        group.bench_with_input(BenchmarkId::new("koopman32", size), &data, |b, data| {
+            b.iter(|| koopman32_with_modulus(black_box(data), 0, m32))
+        });
+
+        // Const-generic hasher: the modulus is compiled in
+        group.bench_with_input(BenchmarkId::new("koopman16_fixed", size), &data, |b, data| {
+            b.iter(|| {
+                let mut hasher = Koopman16Fixed::<32749>::new();
+                hasher.update(black_box(data));
+                hasher.finalize()
+            })
+        });
+        group.bench_with_input(BenchmarkId::new("koopman32_fixed", size), &data, |b, data| {
+            b.iter(|| {
+                let mut hasher = Koopman32Fixed::<2147483629>::new();
+                hasher.update(black_box(data));
+                hasher.finalize()
+            })
+        });
+    }
+
+    group.finish();
+}
+
+fn bench_fixed_length(c: &mut Criterion) {
+    let mut group = c.benchmark_group("FixedLength");
+    fast_config(&mut group);
+
+    // Packet-sized buffers where the length is known at compile time
+    let frame48: [u8; 48] = std::array::from_fn(|i| (i & 0xFF) as u8);
+    let frame128: [u8; 128] = std::array::from_fn(|i| (i & 0xFF) as u8);
+
+    group.throughput(Throughput::Bytes(48));
+    group.bench_function("koopman16/48", |b| {
+        b.iter(|| koopman16(black_box(&frame48[..]), 0))
+    });
+    group.bench_function("koopman16_fixed/48", |b| {
+        b.iter(|| koopman16_fixed(black_box(&frame48), 0))
+    });
+
+    group.throughput(Throughput::Bytes(128));
+    group.bench_function("koopman16/128", |b| {
+        b.iter(|| koopman16(black_box(&frame128[..]), 0))
+    });
+    group.bench_function("koopman16_fixed/128", |b| {
+        b.iter(|| koopman16_fixed(black_box(&frame128), 0))
+    });
+
+    group.finish();
+}
+
+fn bench_batch(c: &mut Criterion) {
+    let mut group = c.benchmark_group("Batch");
+    fast_config(&mut group);
+
+    // Small-packet workload: many independent messages per call
+    for msg_len in [48, 128].iter() {
+        let count = 1024;
+        let backing: Vec<Vec<u8>> = (0..count).map(|_| generate_test_data(*msg_len)).collect();
+        let msgs: Vec<&[u8]> = backing.iter().map(|v| v.as_slice()).collect();
+        let mut out = vec![0u16; count];
+
+        group.throughput(Throughput::Bytes((count * msg_len) as u64));
+
+        group.bench_with_input(BenchmarkId::new("one_shot_loop", msg_len), &msgs, |b, msgs| {
+            b.iter(|| {
+                for (i, msg) in msgs.iter().enumerate() {
+                    out[i] = koopman16(black_box(msg), 0);
+                }
+            })
+        });
+
+        group.bench_with_input(BenchmarkId::new("koopman16_batch", msg_len), &msgs, |b, msgs| {
+            b.iter(|| koopman16_batch_into(black_box(msgs), 0, &mut out))
+        });
+    }
+
+    group.finish();
+}
+
+fn bench_vectored(c: &mut Criterion) {
+    let mut group = c.benchmark_group("Vectored");
+    fast_config(&mut group);
+
+    // A 1434-byte packet split into header + 4 body segments, as a
+    // network stack would hand it over
+    let backing = generate_test_data(1434);
+    let sizes = [54, 345, 345, 345, 345];
+    let mut segments: Vec<&[u8]> = Vec::new();
+    let mut offset = 0;
+    for size in sizes {
+        segments.push(&backing[offset..offset + size]);
+        offset += size;
+    }
+
+    group.throughput(Throughput::Bytes(1434));
+
+    group.bench_function("copy_then_koopman16", |b| {
+        let mut scratch = Vec::with_capacity(1434);
+        b.iter(|| {
+            scratch.clear();
+            for seg in black_box(&segments) {
+                scratch.extend_from_slice(seg);
+            }
+            koopman16(&scratch, 0)
+        })
+    });
+
+    group.bench_function("streaming_updates", |b| {
+        b.iter(|| {
+            let mut hasher = Koopman16::new();
+            for seg in black_box(&segments) {
+                hasher.update(seg);
+            }
+            hasher.finalize()
+        })
+    });
+
+    group.bench_function("koopman16_vectored", |b| {
+        b.iter(|| koopman16_vectored(black_box(&segments), 0))
+    });
+
+    group.bench_function("koopman32_vectored", |b| {
+        b.iter(|| koopman32_vectored(black_box(&segments), 0))
+    });
+
+    group.finish();
+}
+
 fn bench_streaming(c: &mut Criterion) {
     let mut group = c.benchmark_group("Streaming");
     fast_config(&mut group);
@@ -141,16 +362,156 @@ fn bench_streaming(c: &mut Criterion) {
         })
     });
 
-    group.bench_function("streaming_chunked_64", |b| {
+    // A sparse payload: data, a 64 KiB zero run, more data. The zero run
+    // can be streamed byte-by-byte or skipped symbolically.
+    let zeros = vec![0u8; 65536];
+    group.bench_function("zero_run_update", |b| {
         b.iter(|| {
-            let mut hasher = Koopman16::new();
-            for chunk in data.chunks(64) {
-                hasher.update(black_box(chunk));
-            }
+            let mut hasher = Koopman32::new();
+            hasher.update(black_box(&data));
+            hasher.update(black_box(&zeros));
+            hasher.update(black_box(&data));
             hasher.finalize()
         })
     });
 
+    group.bench_function("zero_run_update_zeros", |b| {
+        b.iter(|| {
+            let mut hasher = Koopman32::new();
+            hasher.update(black_box(&data));
+            hasher.update_zeros(black_box(65536));
+            hasher.update(black_box(&data));
+            hasher.finalize()
+        })
+    });
+
+    // Small-chunk feeders (e.g. record bodies arriving piecewise) stress
+    // the per-update prologue
+    for chunk_size in [16, 64, 256] {
+        group.bench_function(format!("streaming_chunked_{}", chunk_size), |b| {
+            b.iter(|| {
+                let mut hasher = Koopman16::new();
+                for chunk in data.chunks(chunk_size) {
+                    hasher.update(black_box(chunk));
+                }
+                hasher.finalize()
+            })
+        });
+    }
+
+    group.finish();
+}
+
+fn bench_large(c: &mut Criterion) {
+    let mut group = c.benchmark_group("Large");
+    fast_config(&mut group);
+    // A handful of samples suffice: at these sizes each iteration already
+    // averages over tens of millions of words
+    group.sample_size(10);
+
+    // DRAM-resident sizes: 1 MiB is L2/L3 territory, 16 MiB spills the
+    // LLC, 128 MiB is pure memory-streaming
+    for size in [1 << 20, 16 << 20, 128 << 20].iter() {
+        let data = generate_test_data(*size);
+
+        group.throughput(Throughput::Bytes(*size as u64));
+
+        group.bench_with_input(BenchmarkId::new("koopman16", size), &data, |b, data| {
+            b.iter(|| koopman16(black_box(data), 0))
+        });
+        group.bench_with_input(BenchmarkId::new("koopman32", size), &data, |b, data| {
+            b.iter(|| koopman32(black_box(data), 0))
+        });
+        group.bench_with_input(BenchmarkId::new("koopman64", size), &data, |b, data| {
+            b.iter(|| koopman64(black_box(data), 0))
+        });
+    }
+
+    group.finish();
+}
+
+fn bench_competitors(c: &mut Criterion) {
+    let mut group = c.benchmark_group("Competitors");
+    fast_config(&mut group);
+    group.sample_size(10);
+
+    // Identical buffers through the common error-detection and fast-hash
+    // baselines, for context when reading the koopman numbers
+    for size in [4096, 1 << 20, 16 << 20].iter() {
+        let data = generate_test_data(*size);
+
+        group.throughput(Throughput::Bytes(*size as u64));
+
+        group.bench_with_input(BenchmarkId::new("koopman32", size), &data, |b, data| {
+            b.iter(|| koopman32(black_box(data), 0))
+        });
+        group.bench_with_input(BenchmarkId::new("crc32fast", size), &data, |b, data| {
+            b.iter(|| crc32fast::hash(black_box(data)))
+        });
+        group.bench_with_input(BenchmarkId::new("adler32", size), &data, |b, data| {
+            b.iter(|| adler::adler32_slice(black_box(data)))
+        });
+        group.bench_with_input(BenchmarkId::new("xxh3_64", size), &data, |b, data| {
+            b.iter(|| xxhash_rust::xxh3::xxh3_64(black_box(data)))
+        });
+    }
+
+    group.finish();
+}
+
+fn bench_misaligned(c: &mut Criterion) {
+    let mut group = c.benchmark_group("Misaligned");
+    fast_config(&mut group);
+
+    // Slices starting at odd offsets, as they arrive from packet parsers
+    // and mapped files; the word kernels use unaligned loads, so this
+    // measures whatever penalty the hardware charges
+    let size = 1 << 20;
+    let backing = generate_test_data(size + 8);
+
+    group.throughput(Throughput::Bytes(size as u64));
+
+    for offset in [0usize, 1, 3, 7] {
+        let data = &backing[offset..offset + size];
+
+        group.bench_with_input(BenchmarkId::new("koopman16", offset), &data, |b, data| {
+            b.iter(|| koopman16(black_box(data), 0))
+        });
+        group.bench_with_input(BenchmarkId::new("koopman32", offset), &data, |b, data| {
+            b.iter(|| koopman32(black_box(data), 0))
+        });
+    }
+
+    group.finish();
+}
+
+fn bench_cold_cache(c: &mut Criterion) {
+    let mut group = c.benchmark_group("ColdCache");
+    fast_config(&mut group);
+    group.sample_size(10);
+
+    // Hot: the same 1 MiB window every iteration, so it settles into
+    // cache. Cold: rotate through disjoint windows of an arena far
+    // larger than any LLC, so every iteration streams from DRAM
+    const WINDOW: usize = 1 << 20;
+    const ARENA: usize = 256 << 20;
+    let arena = generate_test_data(ARENA);
+
+    group.throughput(Throughput::Bytes(WINDOW as u64));
+
+    group.bench_function("koopman32_hot", |b| {
+        b.iter(|| koopman32(black_box(&arena[..WINDOW]), 0))
+    });
+
+    group.bench_function("koopman32_cold", |b| {
+        let mut offset = 0;
+        b.iter(|| {
+            let window = &arena[offset..offset + WINDOW];
+            offset = (offset + WINDOW) % ARENA;
+            koopman32(black_box(window), 0)
+        })
+    });
+
     group.finish();
 }
 
@@ -159,10 +520,32 @@ criterion_group!(
     bench_koopman8,
     bench_koopman16,
     bench_koopman32,
+    bench_koopman64,
     bench_koopman8p,
     bench_koopman16p,
     bench_koopman32p,
+    bench_custom_modulus,
+    bench_fixed_length,
+    bench_batch,
+    bench_vectored,
     bench_streaming,
+    bench_large,
+    bench_competitors,
+    bench_misaligned,
+    bench_cold_cache,
 );
 
-criterion_main!(benches);
+#[cfg(feature = "parallel")]
+criterion_group!(parallel_benches, bench_koopman32_parallel);
+#[cfg(not(feature = "parallel"))]
+criterion_group!(parallel_benches, noop_group);
+
+#[cfg(all(feature = "simd", target_arch = "x86_64"))]
+criterion_group!(simd_benches, bench_simd);
+#[cfg(not(all(feature = "simd", target_arch = "x86_64")))]
+criterion_group!(simd_benches, noop_group);
+
+#[allow(dead_code)]
+fn noop_group(_c: &mut Criterion) {}
+
+criterion_main!(benches, parallel_benches, simd_benches);
@@ -0,0 +1,69 @@
+/* C declarations for the koopman-checksum `capi` feature.
+ *
+ * Build the library with:
+ *
+ *     cargo rustc --release --lib --features capi --crate-type staticlib
+ *     cargo rustc --release --lib --features capi --crate-type cdylib
+ *
+ * and link against libkoopman_checksum.a (static) or
+ * libkoopman_checksum.so (shared) from target/release/.
+ *
+ * Pointer contract for every function: a data pointer must be valid for
+ * its stated length; NULL is accepted only when the length is zero.
+ *
+ * Copyright (c) 2025 the koopman-checksum authors, all rights reserved.
+ * See README.md for licensing information.
+ */
+
+#ifndef KOOPMAN_CHECKSUM_H
+#define KOOPMAN_CHECKSUM_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* One-shot checksums. The p variants trade one checksum bit for a
+ * parity bit, raising error detection from HD=3 to HD=4 within their
+ * length limits. */
+uint8_t koopman8_checksum(const uint8_t *data, size_t len, uint8_t seed);
+uint16_t koopman16_checksum(const uint8_t *data, size_t len, uint8_t seed);
+uint32_t koopman32_checksum(const uint8_t *data, size_t len, uint8_t seed);
+uint64_t koopman64_checksum(const uint8_t *data, size_t len, uint8_t seed);
+uint8_t koopman8p_checksum(const uint8_t *data, size_t len, uint8_t seed);
+uint16_t koopman16p_checksum(const uint8_t *data, size_t len, uint8_t seed);
+uint32_t koopman32p_checksum(const uint8_t *data, size_t len, uint8_t seed);
+
+/* One input to the batch entry points. */
+struct koopman_slice {
+    const uint8_t *ptr;
+    size_t len;
+};
+
+/* Checksum `count` slices in one call, writing one checksum per slice
+ * to `out` (which must hold `count` entries). */
+void koopman16_checksum_batch(const struct koopman_slice *inputs,
+                              size_t count, uint8_t seed, uint16_t *out);
+void koopman32_checksum_batch(const struct koopman_slice *inputs,
+                              size_t count, uint8_t seed, uint32_t *out);
+
+/* Streaming 32-bit hasher. koopman32_hasher_finalize reports the
+ * checksum of everything fed so far without consuming the handle, so
+ * more updates may follow; koopman32_hasher_reset returns the handle to
+ * its initial seeded state. */
+typedef struct koopman32_hasher koopman32_hasher;
+
+koopman32_hasher *koopman32_hasher_new(uint8_t seed);
+void koopman32_hasher_update(koopman32_hasher *hasher, const uint8_t *data,
+                             size_t len);
+uint32_t koopman32_hasher_finalize(const koopman32_hasher *hasher);
+void koopman32_hasher_reset(koopman32_hasher *hasher);
+void koopman32_hasher_free(koopman32_hasher *hasher);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* KOOPMAN_CHECKSUM_H */
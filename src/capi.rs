@@ -0,0 +1,223 @@
+//! C ABI exports (the `capi` feature).
+//!
+//! Exposes the one-shot functions, an opaque streaming handle mirroring
+//! [`Koopman32`](crate::Koopman32), and batch entry points that checksum
+//! an array of (pointer, length) slices in a single FFI crossing — the
+//! shape that matters when per-call overhead competes with checksumming
+//! a few hundred bytes. The matching declarations live in
+//! `include/koopman.h`.
+//!
+//! Build the C library with the `capi` feature, picking the artifact
+//! kind explicitly (a fixed `crate-type` list would force every no_std
+//! build through the staticlib's panic-handler requirement):
+//!
+//! ```text
+//! cargo rustc --release --lib --features capi --crate-type staticlib
+//! cargo rustc --release --lib --features capi --crate-type cdylib
+//! ```
+//!
+//! All functions follow the same pointer contract: a data pointer must
+//! be valid for its stated length, and null is accepted only when the
+//! length is zero.
+
+// Copyright (c) 2025 the koopman-checksum authors, all rights reserved.
+// See README.md for licensing information.
+
+use crate::Koopman32;
+
+/// One input to the batch entry points: a (pointer, length) pair,
+/// layout-compatible with a C `struct koopman_slice`.
+#[repr(C)]
+pub struct KoopmanSlice {
+    pub ptr: *const u8,
+    pub len: usize,
+}
+
+/// Reconstruct a byte slice from an FFI (pointer, length) pair.
+///
+/// # Safety
+/// `ptr` must be valid for reads of `len` bytes, or null with `len` 0.
+#[inline]
+unsafe fn slice_from_raw<'a>(ptr: *const u8, len: usize) -> &'a [u8] {
+    if len == 0 {
+        &[]
+    } else {
+        core::slice::from_raw_parts(ptr, len)
+    }
+}
+
+macro_rules! export_one_shot {
+    ($export:ident, $rust:path, $output:ty, $doc_name:literal) => {
+        #[doc = concat!("One-shot ", $doc_name, " of `len` bytes at `data`.")]
+        ///
+        /// # Safety
+        /// `data` must be valid for reads of `len` bytes, or null with
+        /// `len` 0.
+        #[no_mangle]
+        pub unsafe extern "C" fn $export(data: *const u8, len: usize, seed: u8) -> $output {
+            $rust(slice_from_raw(data, len), seed)
+        }
+    };
+}
+
+export_one_shot!(koopman8_checksum, crate::koopman8, u8, "[`koopman8`](crate::koopman8)");
+export_one_shot!(koopman16_checksum, crate::koopman16, u16, "[`koopman16`](crate::koopman16)");
+export_one_shot!(koopman32_checksum, crate::koopman32, u32, "[`koopman32`](crate::koopman32)");
+export_one_shot!(koopman64_checksum, crate::koopman64, u64, "[`koopman64`](crate::koopman64)");
+export_one_shot!(koopman8p_checksum, crate::koopman8p, u8, "[`koopman8p`](crate::koopman8p)");
+export_one_shot!(koopman16p_checksum, crate::koopman16p, u16, "[`koopman16p`](crate::koopman16p)");
+export_one_shot!(koopman32p_checksum, crate::koopman32p, u32, "[`koopman32p`](crate::koopman32p)");
+
+macro_rules! export_batch {
+    ($export:ident, $one_shot:path, $output:ty, $doc_name:literal) => {
+        #[doc = concat!("Checksum `count` slices with ", $doc_name, ",")]
+        /// writing one checksum per slice to `out` — a single FFI
+        /// crossing instead of one per message.
+        ///
+        /// # Safety
+        /// `inputs` must be valid for reads of `count` entries, each
+        /// entry's pointer valid for its length (null only with length
+        /// 0), and `out` valid for writes of `count` checksums.
+        #[no_mangle]
+        pub unsafe extern "C" fn $export(
+            inputs: *const KoopmanSlice,
+            count: usize,
+            seed: u8,
+            out: *mut $output,
+        ) {
+            if count == 0 {
+                return;
+            }
+            let inputs = core::slice::from_raw_parts(inputs, count);
+            let out = core::slice::from_raw_parts_mut(out, count);
+            for (input, cs) in inputs.iter().zip(out) {
+                *cs = $one_shot(slice_from_raw(input.ptr, input.len), seed);
+            }
+        }
+    };
+}
+
+export_batch!(
+    koopman16_checksum_batch,
+    crate::koopman16,
+    u16,
+    "[`koopman16`](crate::koopman16)"
+);
+export_batch!(
+    koopman32_checksum_batch,
+    crate::koopman32,
+    u32,
+    "[`koopman32`](crate::koopman32)"
+);
+
+/// Allocate a streaming 32-bit hasher, the C counterpart of
+/// [`Koopman32::with_seed`](crate::Koopman32::with_seed). Free it with
+/// [`koopman32_hasher_free`].
+#[no_mangle]
+pub extern "C" fn koopman32_hasher_new(seed: u8) -> *mut Koopman32 {
+    Box::into_raw(Box::new(Koopman32::with_seed(seed)))
+}
+
+/// Feed `len` bytes at `data` into the hasher.
+///
+/// # Safety
+/// `hasher` must come from [`koopman32_hasher_new`] and not be freed;
+/// `data` must be valid for reads of `len` bytes, or null with `len` 0.
+#[no_mangle]
+pub unsafe extern "C" fn koopman32_hasher_update(
+    hasher: *mut Koopman32,
+    data: *const u8,
+    len: usize,
+) {
+    (*hasher).update(slice_from_raw(data, len));
+}
+
+/// Return the checksum of everything fed so far without consuming the
+/// hasher — more data may follow, as with
+/// [`Koopman32::finalize`](crate::Koopman32::finalize) on a clone.
+///
+/// # Safety
+/// `hasher` must come from [`koopman32_hasher_new`] and not be freed.
+#[no_mangle]
+pub unsafe extern "C" fn koopman32_hasher_finalize(hasher: *const Koopman32) -> u32 {
+    (*hasher).clone().finalize()
+}
+
+/// Reset the hasher to its initial (seeded) state.
+///
+/// # Safety
+/// `hasher` must come from [`koopman32_hasher_new`] and not be freed.
+#[no_mangle]
+pub unsafe extern "C" fn koopman32_hasher_reset(hasher: *mut Koopman32) {
+    (*hasher).reset();
+}
+
+/// Free a hasher allocated by [`koopman32_hasher_new`]. Null is a no-op.
+///
+/// # Safety
+/// `hasher` must come from [`koopman32_hasher_new`] and not already be
+/// freed.
+#[no_mangle]
+pub unsafe extern "C" fn koopman32_hasher_free(hasher: *mut Koopman32) {
+    if !hasher.is_null() {
+        drop(Box::from_raw(hasher));
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn test_one_shot_exports_match_rust() {
+        let data = b"ffi test data";
+        // SAFETY: pointers come from live slices with matching lengths
+        unsafe {
+            assert_eq!(
+                koopman32_checksum(data.as_ptr(), data.len(), 0xee),
+                crate::koopman32(data, 0xee)
+            );
+            assert_eq!(
+                koopman16p_checksum(data.as_ptr(), data.len(), 0),
+                crate::koopman16p(data, 0)
+            );
+            assert_eq!(koopman64_checksum(core::ptr::null(), 0, 0), 0);
+        }
+    }
+
+    #[test]
+    fn test_batch_export_matches_one_shot() {
+        let msgs: [&[u8]; 4] = [b"alpha", b"", b"gamma delta", b"x"];
+        let inputs: Vec<KoopmanSlice> = msgs
+            .iter()
+            .map(|m| KoopmanSlice { ptr: m.as_ptr(), len: m.len() })
+            .collect();
+        let mut out = [0u32; 4];
+        // SAFETY: inputs and out both have msgs.len() valid entries
+        unsafe {
+            koopman32_checksum_batch(inputs.as_ptr(), inputs.len(), 0xee, out.as_mut_ptr());
+        }
+        for (msg, cs) in msgs.iter().zip(out) {
+            assert_eq!(cs, crate::koopman32(msg, 0xee));
+        }
+    }
+
+    #[test]
+    fn test_streaming_handle_round_trip() {
+        let data = b"streamed in two pieces";
+        let hasher = koopman32_hasher_new(0xee);
+        // SAFETY: the handle is live until the free below
+        unsafe {
+            koopman32_hasher_update(hasher, data.as_ptr(), 10);
+            koopman32_hasher_update(hasher, data[10..].as_ptr(), data.len() - 10);
+            assert_eq!(koopman32_hasher_finalize(hasher), crate::koopman32(data, 0xee));
+
+            koopman32_hasher_reset(hasher);
+            koopman32_hasher_update(hasher, data.as_ptr(), data.len());
+            assert_eq!(koopman32_hasher_finalize(hasher), crate::koopman32(data, 0xee));
+
+            koopman32_hasher_free(hasher);
+            koopman32_hasher_free(core::ptr::null_mut());
+        }
+    }
+}
@@ -0,0 +1,218 @@
+//! Pipelined file and reader checksumming.
+//!
+//! A verification pass that alternates `read()` and `update()` serializes
+//! I/O and compute: total time is read-time plus checksum-time. The
+//! functions here overlap the two with a classic double-buffered pipeline —
+//! a dedicated reader thread fills the next buffer while the calling
+//! thread checksums the current one, with buffers recycled through a
+//! bounded channel — so total time approaches the slower of the two
+//! streams. No async runtime is involved; a thread and two channels are
+//! all the machinery the overlap needs.
+//!
+//! Results are bit-identical to the synchronous one-shot and streaming
+//! APIs.
+
+// Copyright (c) 2025 the koopman-checksum authors, all rights reserved.
+// See README.md for licensing information.
+
+use crate::{koopman32_consume, koopman32_finalize};
+use std::fs::File;
+use std::io::Read;
+use std::path::Path;
+use std::sync::mpsc;
+
+/// Size of each pipeline buffer. Large enough that the word kernel and
+/// the read syscalls amortize their per-call overhead, small enough that
+/// the buffers in flight stay cache- and memory-friendly.
+const CHUNK_SIZE: usize = 1 << 20;
+
+/// Buffers in flight. Two suffice for the steady-state overlap (one
+/// being read, one being checksummed); two more absorb scheduling
+/// jitter between the threads.
+const PIPELINE_DEPTH: usize = 4;
+
+/// Run `reader` through the pipeline, feeding each filled buffer to
+/// `consume` on the calling thread while the reader thread fetches the
+/// next one.
+fn pipeline<R, F>(mut reader: R, mut consume: F) -> std::io::Result<()>
+where
+    R: Read + Send,
+    F: FnMut(&[u8]),
+{
+    let (full_tx, full_rx) = mpsc::sync_channel::<std::io::Result<Vec<u8>>>(PIPELINE_DEPTH);
+    let (empty_tx, empty_rx) = mpsc::channel::<Vec<u8>>();
+    for _ in 0..PIPELINE_DEPTH {
+        empty_tx.send(vec![0u8; CHUNK_SIZE]).unwrap();
+    }
+
+    std::thread::scope(|scope| {
+        let recycle_tx = empty_tx.clone();
+        scope.spawn(move || {
+            // Reader side: recycle an empty buffer, fill it, hand it over.
+            // A send failure means the consumer bailed on an earlier error
+            while let Ok(mut buf) = empty_rx.recv() {
+                buf.resize(CHUNK_SIZE, 0);
+                match reader.read(&mut buf) {
+                    Ok(0) => break,
+                    Ok(n) => {
+                        buf.truncate(n);
+                        if full_tx.send(Ok(buf)).is_err() {
+                            break;
+                        }
+                    }
+                    Err(err) if err.kind() == std::io::ErrorKind::Interrupted => {
+                        let _ = recycle_tx.send(buf);
+                    }
+                    Err(err) => {
+                        let _ = full_tx.send(Err(err));
+                        break;
+                    }
+                }
+            }
+        });
+
+        // Consumer side: checksum each buffer as it lands, then return it
+        // to the reader. The channel closing is end-of-file
+        for filled in full_rx {
+            let buf = filled?;
+            consume(&buf);
+            let _ = empty_tx.send(buf);
+        }
+        Ok(())
+    })
+}
+
+/// Compute a 32-bit Koopman checksum of a reader's contents, overlapping
+/// reads with checksumming.
+///
+/// Identical to feeding the stream through [`koopman32`](crate::koopman32)
+/// with a seed of 0, and runs the same word-at-a-time kernel; the reader
+/// thread keeps the next chunk in flight while the current one is being
+/// checksummed.
+///
+/// # Errors
+/// Propagates any I/O error from the reader.
+pub fn checksum32_reader<R: Read + Send>(reader: R) -> std::io::Result<u32> {
+    let mut sum: u64 = 0;
+    let mut initialized = false;
+    pipeline(reader, |chunk| {
+        let body = if initialized {
+            chunk
+        } else {
+            // Seed of 0: the first byte passes through the XOR unchanged
+            sum = chunk[0] as u64;
+            initialized = true;
+            &chunk[1..]
+        };
+        sum = koopman32_consume(sum, body);
+    })?;
+    if !initialized {
+        return Ok(0);
+    }
+    Ok(koopman32_finalize(sum))
+}
+
+/// Compute a 32-bit Koopman checksum of a file, overlapping reads with
+/// checksumming.
+///
+/// # Errors
+/// Propagates any I/O error from opening or reading the file.
+///
+/// # Example
+/// ```rust,no_run
+/// use koopman_checksum::io::checksum32_file;
+///
+/// let checksum = checksum32_file("/var/backups/archive.tar").unwrap();
+/// ```
+pub fn checksum32_file<P: AsRef<Path>>(path: P) -> std::io::Result<u32> {
+    checksum32_reader(File::open(path)?)
+}
+
+/// Feed a reader's contents through any [`core::hash::Hasher`] with the
+/// same read/compute overlap, returning the fed hasher.
+///
+/// Useful for the other streaming hashers — pass
+/// [`Koopman64::new()`](crate::Koopman64) or a seeded or custom-modulus
+/// hasher and call its `finalize` on the result. [`checksum32_reader`]
+/// is faster for the default 32-bit checksum: it runs the word kernel
+/// instead of the hasher's byte-at-a-time update.
+///
+/// # Errors
+/// Propagates any I/O error from the reader.
+///
+/// # Example
+/// ```rust
+/// use koopman_checksum::{koopman64, Koopman64};
+/// use koopman_checksum::io::reader_into_hasher;
+///
+/// let data = b"stream contents";
+/// let hasher = reader_into_hasher(&data[..], Koopman64::new()).unwrap();
+/// assert_eq!(hasher.finalize(), koopman64(data, 0));
+/// ```
+pub fn reader_into_hasher<R, H>(reader: R, mut hasher: H) -> std::io::Result<H>
+where
+    R: Read + Send,
+    H: core::hash::Hasher,
+{
+    pipeline(reader, |chunk| hasher.write(chunk))?;
+    Ok(hasher)
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    /// A reader that delivers data in deliberately awkward slices so the
+    /// pipeline sees short reads and odd chunk boundaries.
+    struct RaggedReader<'a> {
+        data: &'a [u8],
+        step: usize,
+    }
+
+    impl Read for RaggedReader<'_> {
+        fn read(&mut self, buf: &mut [u8]) -> std::io::Result<usize> {
+            let n = self.step.min(self.data.len()).min(buf.len());
+            buf[..n].copy_from_slice(&self.data[..n]);
+            self.data = &self.data[n..];
+            self.step = self.step % 7 + 1;
+            Ok(n)
+        }
+    }
+
+    #[test]
+    fn test_checksum32_reader_matches_one_shot() {
+        let data: Vec<u8> = (0..3 * CHUNK_SIZE + 13).map(|i| (i % 251) as u8).collect();
+        let expected = crate::koopman32(&data, 0);
+
+        assert_eq!(checksum32_reader(data.as_slice()).unwrap(), expected);
+        assert_eq!(
+            checksum32_reader(RaggedReader { data: &data[..4000], step: 1 }).unwrap(),
+            crate::koopman32(&data[..4000], 0)
+        );
+        assert_eq!(checksum32_reader(&[] as &[u8]).unwrap(), 0);
+    }
+
+    #[test]
+    fn test_checksum32_file_round_trip() {
+        let data: Vec<u8> = (0..100_000).map(|i| (i % 247) as u8).collect();
+        let path = std::env::temp_dir().join(format!("koopman-io-test-{}", std::process::id()));
+        std::fs::write(&path, &data).unwrap();
+
+        let result = checksum32_file(&path);
+        std::fs::remove_file(&path).unwrap();
+        assert_eq!(result.unwrap(), crate::koopman32(&data, 0));
+
+        assert!(checksum32_file(&path).is_err());
+    }
+
+    #[test]
+    fn test_reader_into_hasher_matches_streaming() {
+        let data: Vec<u8> = (0..50_000).map(|i| (i % 241) as u8).collect();
+
+        let hasher = reader_into_hasher(data.as_slice(), crate::Koopman64::new()).unwrap();
+        assert_eq!(hasher.finalize(), crate::koopman64(&data, 0));
+
+        let hasher = reader_into_hasher(data.as_slice(), crate::Koopman16P::with_seed(0xee)).unwrap();
+        assert_eq!(hasher.finalize(), crate::koopman16p(&data, 0xee));
+    }
+}
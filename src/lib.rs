@@ -6,6 +6,17 @@
 
 use core::num::{NonZeroU32, NonZeroU64};
 
+#[cfg(feature = "capi")]
+pub mod capi;
+#[cfg(feature = "std")]
+pub mod io;
+#[cfg(all(feature = "simd", target_arch = "x86_64"))]
+pub mod simd;
+#[cfg(feature = "telemetry")]
+pub mod telemetry;
+#[cfg(feature = "validation")]
+pub mod validation;
+
 // ============================================================================
 // Constants
 // ============================================================================
@@ -22,6 +33,12 @@ pub const MODULUS_16: u32 = 65519;
 /// Detects all 1-bit and 2-bit errors for data up to 134,217,720 bytes.
 pub const MODULUS_32: u64 = 4294967291;
 
+/// Recommended modulus for 64-bit Koopman checksum.
+/// 2^64 - 59, the largest 64-bit prime. Detects all 1-bit and 2-bit errors
+/// for data far beyond the 32-bit variant's 134 MB limit (up to ~2^59 bytes,
+/// following the same length-to-modulus ratio as MODULUS_32).
+pub const MODULUS_64: u128 = 18446744073709551557;
+
 /// Modulus for 7-bit Koopman checksum with parity.
 /// Detects all 1-bit, 2-bit, and 3-bit errors for data up to 5 bytes.
 pub const MODULUS_7P: u32 = 125;
@@ -34,9 +51,15 @@ pub const MODULUS_15P: u32 = 32749;
 /// Detects all 1-bit, 2-bit, and 3-bit errors for data up to 134,217,720 bytes.
 pub const MODULUS_31P: u64 = 2147483629;
 
+// The default moduli as NonZero values, for exercising the generic
+// custom-modulus paths against the fast paths in tests
+#[cfg(test)]
 const NONZERO_MODULUS_8: NonZeroU32 = NonZeroU32::new(MODULUS_8).unwrap();
+#[cfg(test)]
 const NONZERO_MODULUS_7P: NonZeroU32 = NonZeroU32::new(MODULUS_7P).unwrap();
+#[cfg(test)]
 const NONZERO_MODULUS_15P: NonZeroU32 = NonZeroU32::new(MODULUS_15P).unwrap();
+#[cfg(test)]
 const NONZERO_MODULUS_31P: NonZeroU64 = NonZeroU64::new(MODULUS_31P).unwrap();
 
 // ============================================================================
@@ -52,7 +75,7 @@ const NONZERO_MODULUS_31P: NonZeroU64 = NonZeroU64::new(MODULUS_31P).unwrap();
 /// Fast reduction for modulus 65519 = 2^16 - 17
 /// Input: x up to (MODULUS_16 - 1) << 16 + 0xFFFF ~= 4_293_918_719 (remains < 2^32)
 #[inline(always)]
-fn fast_mod_65519(x: u32) -> u32 {
+pub(crate) fn fast_mod_65519(x: u32) -> u32 {
     // First reduction: x = hi * 2^16 + lo, result = hi * 17 + lo
     let hi: u32 = x >> 16;
     let lo: u32 = x & 0xFFFF;
@@ -69,7 +92,7 @@ fn fast_mod_65519(x: u32) -> u32 {
 /// Fast reduction for modulus 4294967291 = 2^32 - 5
 /// Input: x < 2^40 (after shift+add)
 #[inline(always)]
-fn fast_mod_4294967291(x: u64) -> u64 {
+pub(crate) fn fast_mod_4294967291(x: u64) -> u64 {
     // x = hi * 2^32 + lo, result = hi * 5 + lo
     let hi: u64 = x >> 32;
     let lo: u64 = x & 0xFFFFFFFF;
@@ -78,6 +101,235 @@ fn fast_mod_4294967291(x: u64) -> u64 {
     if r >= MODULUS_32 { r - MODULUS_32 } else { r }
 }
 
+/// Fast reduction for modulus 18446744073709551557 = 2^64 - 59
+/// Input: x < 60 * 2^64 (after a word step or a byte shift+add)
+#[inline(always)]
+fn fast_mod_18446744073709551557(x: u128) -> u64 {
+    // x = hi * 2^64 + lo, result = hi * 59 + lo
+    let hi = (x >> 64) as u64;
+    let lo = x & 0xFFFF_FFFF_FFFF_FFFF;
+    let r = hi as u128 * 59 + lo;
+    // r < 2^64 + 60 * 59, need one check
+    if r >= MODULUS_64 {
+        (r - MODULUS_64) as u64
+    } else {
+        r as u64
+    }
+}
+
+/// Fast reduction for the parity modulus 125 (2^7 ≡ 3 mod 125)
+/// Input: x < 2^17 (after shift+add, seeded first byte unreduced)
+#[inline(always)]
+fn fast_mod_125(x: u32) -> u32 {
+    // x = hi * 2^7 + lo, result = hi * 3 + lo
+    let r = (x >> 7) * 3 + (x & 0x7F);
+    // r < 3 * 2^10 + 2^7: one more fold
+    let r2 = (r >> 7) * 3 + (r & 0x7F);
+    // r2 < 3 * 25 + 128, need one check
+    if r2 >= MODULUS_7P {
+        r2 - MODULUS_7P
+    } else {
+        r2
+    }
+}
+
+/// Fast reduction for the parity modulus 32749 = 2^15 - 19
+/// Input: x < 2^23 (after shift+add)
+#[inline(always)]
+fn fast_mod_32749(x: u32) -> u32 {
+    // x = hi * 2^15 + lo, result = hi * 19 + lo
+    let r = (x >> 15) * 19 + (x & 0x7FFF);
+    // r < 19 * 2^8 + 2^15: one more fold
+    let r2 = (r >> 15) * 19 + (r & 0x7FFF);
+    // r2 < 19 + 2^15, need one check
+    if r2 >= MODULUS_15P {
+        r2 - MODULUS_15P
+    } else {
+        r2
+    }
+}
+
+/// Fast reduction for the parity modulus 2147483629 = 2^31 - 19
+/// Input: x < 2^44 (after a word step or a byte shift+add)
+#[inline(always)]
+fn fast_mod_2147483629(x: u64) -> u64 {
+    // x = hi * 2^31 + lo, result = hi * 19 + lo
+    let r = (x >> 31) * 19 + (x & 0x7FFF_FFFF);
+    // r < 19 * 2^13 + 2^31: one more fold
+    let r2 = (r >> 31) * 19 + (r & 0x7FFF_FFFF);
+    // r2 < 19 + 2^31, need one check
+    if r2 >= MODULUS_31P {
+        r2 - MODULUS_31P
+    } else {
+        r2
+    }
+}
+
+/// Precomputed (state << 8) mod 253 for every 8-bit state.
+///
+/// The 8-bit recurrence only ever reduces values of the form
+/// (state << 8) + byte, so the shifted-state residue can be looked up and
+/// the byte added afterwards with at most two corrective subtractions.
+/// Indexed by the full 0-255 range because the seeded first byte enters
+/// unreduced.
+const SHIFT_TABLE_8: [u8; 256] = {
+    let mut table = [0u8; 256];
+    let mut s = 0usize;
+    while s < 256 {
+        table[s] = ((s << 8) % (MODULUS_8 as usize)) as u8;
+        s += 1;
+    }
+    table
+};
+
+/// Table-driven reduction for the default 8-bit modulus 253.
+/// Input: x = (state << 8) + byte with state < 256
+#[inline(always)]
+fn table_mod_8(x: u32) -> u32 {
+    let mut r = SHIFT_TABLE_8[(x >> 8) as usize] as u32 + (x & 0xFF);
+    // r < 252 + 256: at most two corrections
+    if r >= MODULUS_8 {
+        r -= MODULUS_8;
+    }
+    if r >= MODULUS_8 {
+        r -= MODULUS_8;
+    }
+    r
+}
+
+// ============================================================================
+// Barrett Reduction for Custom Moduli
+//
+// A modulus supplied at construction time is invariant, so the hardware
+// division behind `x % modulus` can be replaced by a multiply with a
+// precomputed reciprocal and a shift. With rcp = floor((2^W - 1) / m) the
+// quotient estimate q = (x * rcp) >> W never overshoots floor(x / m) and
+// undershoots by at most 3, so x - q*m lands in [0, m) after a few
+// conditional subtractions.
+// ============================================================================
+
+/// Reciprocal of `modulus` for [`barrett_mod_u32`].
+#[inline(always)]
+fn barrett_rcp_u32(modulus: u32) -> u32 {
+    u32::MAX / modulus
+}
+
+/// Reduce `x` modulo `modulus` using a precomputed reciprocal.
+#[inline(always)]
+fn barrett_mod_u32(x: u32, modulus: u32, rcp: u32) -> u32 {
+    let q = ((x as u64 * rcp as u64) >> 32) as u32;
+    let mut r = x - q.wrapping_mul(modulus);
+    while r >= modulus {
+        r -= modulus;
+    }
+    r
+}
+
+/// Reciprocal of `modulus` for [`barrett_mod_u64`].
+#[inline(always)]
+fn barrett_rcp_u64(modulus: u64) -> u64 {
+    u64::MAX / modulus
+}
+
+/// Reduce `x` modulo `modulus` using a precomputed reciprocal.
+#[inline(always)]
+fn barrett_mod_u64(x: u64, modulus: u64, rcp: u64) -> u64 {
+    let q = ((x as u128 * rcp as u128) >> 64) as u64;
+    let mut r = x - q.wrapping_mul(modulus);
+    while r >= modulus {
+        r -= modulus;
+    }
+    r
+}
+
+// ============================================================================
+// Runtime Kernel Dispatch
+//
+// One binary has to run well across hosts with different vector support, so
+// the default-modulus `koopman16`/`koopman32` paths pick their inner loop
+// once per process: the first large buffer probes the CPU, the choice is
+// cached in an atomic, and steady state costs one relaxed load and a
+// predicted branch per call. The cache holds a kernel tag rather than a raw
+// function pointer — same cost, no unsafe, and `selected_kernel` /
+// `override_kernel` can inspect and pin it for benchmarking. Buffers under
+// `simd::SIMD_THRESHOLD` skip the question entirely; without the `simd`
+// feature (or off x86_64) everything folds to the scalar word kernel at
+// compile time.
+// ============================================================================
+
+/// Inner-loop kernel used by the default-modulus [`koopman16`] and
+/// [`koopman32`] paths for buffers of at least `simd::SIMD_THRESHOLD`
+/// bytes.
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+pub enum Kernel {
+    /// Portable word-at-a-time scalar kernel. Always available.
+    Scalar,
+    /// AVX2 lane-split kernel (`simd` feature on x86_64 with AVX2).
+    Avx2,
+}
+
+const KERNEL_UNRESOLVED: u8 = 0;
+const KERNEL_SCALAR: u8 = 1;
+const KERNEL_AVX2: u8 = 2;
+
+static SELECTED_KERNEL: core::sync::atomic::AtomicU8 =
+    core::sync::atomic::AtomicU8::new(KERNEL_UNRESOLVED);
+
+/// Probe the CPU and cache the result. Out of line: runs once per process
+/// (or again after a racing first call, which picks the same answer).
+#[cold]
+fn resolve_kernel() -> u8 {
+    #[cfg(all(feature = "simd", target_arch = "x86_64"))]
+    let selected = if std::arch::is_x86_feature_detected!("avx2") {
+        KERNEL_AVX2
+    } else {
+        KERNEL_SCALAR
+    };
+    #[cfg(not(all(feature = "simd", target_arch = "x86_64")))]
+    let selected = KERNEL_SCALAR;
+
+    SELECTED_KERNEL.store(selected, core::sync::atomic::Ordering::Relaxed);
+    selected
+}
+
+/// The kernel large [`koopman16`]/[`koopman32`] calls currently dispatch
+/// to, probing the CPU on first use.
+#[must_use]
+pub fn selected_kernel() -> Kernel {
+    let mut raw = SELECTED_KERNEL.load(core::sync::atomic::Ordering::Relaxed);
+    if raw == KERNEL_UNRESOLVED {
+        raw = resolve_kernel();
+    }
+    if raw == KERNEL_AVX2 {
+        Kernel::Avx2
+    } else {
+        Kernel::Scalar
+    }
+}
+
+/// Pin the dispatched kernel, overriding automatic selection — useful for
+/// benchmarking one kernel against another on the same host.
+///
+/// # Returns
+/// `true` if the kernel was selected; `false` (leaving the selection
+/// unchanged) if this build or CPU cannot run it
+pub fn override_kernel(kernel: Kernel) -> bool {
+    let raw = match kernel {
+        Kernel::Scalar => KERNEL_SCALAR,
+        #[cfg(all(feature = "simd", target_arch = "x86_64"))]
+        Kernel::Avx2 => {
+            if !std::arch::is_x86_feature_detected!("avx2") {
+                return false;
+            }
+            KERNEL_AVX2
+        }
+        #[cfg(not(all(feature = "simd", target_arch = "x86_64")))]
+        Kernel::Avx2 => return false,
+    };
+    SELECTED_KERNEL.store(raw, core::sync::atomic::Ordering::Relaxed);
+    true
+}
+
 /// Compute an 8-bit Koopman checksum.
 ///
 /// Detects all 1-bit and 2-bit errors for data up to 13 bytes with modulus 253.
@@ -99,7 +351,21 @@ fn fast_mod_4294967291(x: u64) -> u64 {
 #[inline]
 #[must_use]
 pub fn koopman8(data: &[u8], initial_seed: u8) -> u8 {
-    koopman8_with_modulus(data, initial_seed, NONZERO_MODULUS_8)
+    if data.is_empty() {
+        return 0;
+    }
+
+    let mut sum: u32 = (data[0] ^ initial_seed) as u32;
+
+    // One L1 load and an add-and-correct per byte for the default modulus
+    for &byte in &data[1..] {
+        sum = table_mod_8((sum << 8) + byte as u32);
+    }
+
+    // Append implicit zero byte
+    sum = table_mod_8(sum << 8);
+
+    sum as u8
 }
 
 /// Compute an 8-bit Koopman checksum with a custom modulus.
@@ -128,14 +394,15 @@ pub fn koopman8_with_modulus(data: &[u8], initial_seed: u8, modulus: NonZeroU32)
     }
 
     let modulus = modulus.get();
+    let rcp = barrett_rcp_u32(modulus);
     let mut sum: u32 = (data[0] ^ initial_seed) as u32;
 
     for &byte in &data[1..] {
-        sum = ((sum << 8) + byte as u32) % modulus;
+        sum = barrett_mod_u32((sum << 8) + byte as u32, modulus, rcp);
     }
 
     // Append implicit zero byte
-    sum = (sum << 8) % modulus;
+    sum = barrett_mod_u32(sum << 8, modulus, rcp);
 
     sum as u8
 }
@@ -144,6 +411,10 @@ pub fn koopman8_with_modulus(data: &[u8], initial_seed: u8, modulus: NonZeroU32)
 ///
 /// Detects all 1-bit and 2-bit errors for data up to 4092 bytes.
 ///
+/// With the `simd` feature, buffers of at least `simd::SIMD_THRESHOLD`
+/// bytes dispatch to the best kernel for the host CPU; see
+/// [`selected_kernel`].
+///
 /// # Arguments
 /// * `data` - The data bytes to checksum
 /// * `initial_seed` - Initial seed value
@@ -165,30 +436,296 @@ pub fn koopman16(data: &[u8], initial_seed: u8) -> u16 {
         return 0;
     }
 
-    let mut sum: u64 = (data[0] ^ initial_seed) as u64;
+    #[cfg(all(feature = "simd", target_arch = "x86_64"))]
+    if data.len() >= simd::SIMD_THRESHOLD && selected_kernel() == Kernel::Avx2 {
+        if let Some(checksum) = simd::koopman16(data, initial_seed) {
+            return checksum;
+        }
+    }
 
-    // Process bytes with delayed modulo reduction every 2 bytes
-    // This reduces the number of modulo operations by half
-    let mut count = 0;
-    for &byte in &data[1..] {
-        sum = (sum << 8) + byte as u64;
-        count += 1;
-        if count == 2 {
-            sum = fast_mod_65519(sum as u32) as u64;
-            count = 0;
+    let sum = koopman16_consume((data[0] ^ initial_seed) as u32, &data[1..]);
+    koopman16_finalize(sum)
+}
+
+/// One word-kernel Horner step: advance `sum` across an 8-byte big-endian
+/// word. Since 2^16 ≡ 17 (mod 2^16 - 17) the word's four 16-bit limbs fold
+/// in with weights 17^3, 17^2, 17, 1 while 256^8 = 2^64 ≡ 17^4 ≡ 18002.
+/// The folded accumulator stays under 2^31, within fast_mod_65519's input
+/// bound, so one reduction per word suffices — no per-byte branch, no
+/// per-byte bounds check.
+#[inline(always)]
+fn koopman16_word_step(sum: u32, word: u64) -> u32 {
+    let l3 = (word >> 48) as u32;
+    let l2 = (word >> 32) as u32 & 0xFFFF;
+    let l1 = (word >> 16) as u32 & 0xFFFF;
+    let l0 = word as u32 & 0xFFFF;
+    fast_mod_65519(sum * 18002 + l3 * 4913 + l2 * 289 + l1 * 17 + l0)
+}
+
+/// Advance a Koopman16 accumulator across `body`: whole 8-byte words
+/// through the word kernel, tail bytes with delayed reduction.
+#[inline]
+fn koopman16_consume(mut sum: u32, body: &[u8]) -> u32 {
+    let mut chunks = body.chunks_exact(8);
+    for chunk in chunks.by_ref() {
+        sum = koopman16_word_step(sum, u64::from_be_bytes(chunk.try_into().unwrap()));
+    }
+
+    // Tail bytes keep the delayed-reduction scheme: up to 2 bytes fit in
+    // the accumulator between reductions (sum < 65519, so
+    // (sum << 16) + 0xFFFF < 2^32)
+    for pair in chunks.remainder().chunks(2) {
+        for &byte in pair {
+            sum = (sum << 8) + byte as u32;
         }
+        sum = fast_mod_65519(sum);
     }
+    sum
+}
 
-    // Final reduction if needed
-    if count > 0 {
-        sum = fast_mod_65519(sum as u32) as u64;
+/// Append the two implicit zero bytes and narrow to the output width.
+/// Both shifts collapse into one multiply: 2^16 ≡ 17 (mod 2^16 - 17).
+#[inline(always)]
+fn koopman16_finalize(sum: u32) -> u16 {
+    fast_mod_65519(sum * 17) as u16
+}
+
+/// Compute a 16-bit Koopman checksum over non-contiguous segments.
+///
+/// Checksums a logical message scattered across several buffers (e.g. a
+/// packet split between a header arena and body ring-buffer slices)
+/// without copying it into scratch storage. Bit-identical to
+/// [`koopman16`] over the concatenation of the segments.
+///
+/// Word alignment is carried across segment boundaries: bytes straddling
+/// a boundary are staged into one 8-byte word, so the interior of every
+/// segment still runs through the word kernel. The segments may be
+/// `&[u8]`, `std::io::IoSlice`, or anything else dereferencing to bytes.
+///
+/// # Arguments
+/// * `bufs` - The message segments, in order
+/// * `initial_seed` - Initial seed value
+///
+/// # Returns
+/// 16-bit checksum value, or 0 if all segments are empty
+///
+/// # Example
+/// ```rust
+/// use koopman_checksum::{koopman16, koopman16_vectored};
+///
+/// let segments: [&[u8]; 3] = [b"head", b"er and ", b"body"];
+/// assert_eq!(
+///     koopman16_vectored(&segments, 0xee),
+///     koopman16(b"header and body", 0xee)
+/// );
+/// ```
+#[must_use]
+pub fn koopman16_vectored<B: AsRef<[u8]>>(bufs: &[B], initial_seed: u8) -> u16 {
+    let mut sum = 0u32;
+    let mut started = false;
+    let mut carry = [0u8; 8];
+    let mut carry_len = 0usize;
+
+    for buf in bufs {
+        let mut seg = buf.as_ref();
+        if seg.is_empty() {
+            continue;
+        }
+        if !started {
+            sum = (seg[0] ^ initial_seed) as u32;
+            started = true;
+            seg = &seg[1..];
+        }
+
+        // Top up the straddling word with this segment's leading bytes
+        if carry_len > 0 {
+            let take = (8 - carry_len).min(seg.len());
+            carry[carry_len..carry_len + take].copy_from_slice(&seg[..take]);
+            carry_len += take;
+            seg = &seg[take..];
+            if carry_len < 8 {
+                continue;
+            }
+            sum = koopman16_word_step(sum, u64::from_be_bytes(carry));
+        }
+
+        let mut chunks = seg.chunks_exact(8);
+        for chunk in chunks.by_ref() {
+            sum = koopman16_word_step(sum, u64::from_be_bytes(chunk.try_into().unwrap()));
+        }
+
+        // Stage the tail; the next segment may complete the word
+        let rem = chunks.remainder();
+        carry[..rem.len()].copy_from_slice(rem);
+        carry_len = rem.len();
     }
 
-    // Append two implicit zero bytes
-    sum = fast_mod_65519((sum << 8) as u32) as u64;
-    sum = fast_mod_65519((sum << 8) as u32) as u64;
+    if !started {
+        return 0;
+    }
+    koopman16_finalize(koopman16_consume(sum, &carry[..carry_len]))
+}
 
-    sum as u16
+/// Compute a 16-bit Koopman checksum of a fixed-length buffer.
+///
+/// Monomorphizes per length: every trip count below is a compile-time
+/// constant, so the loops unroll fully for small `N`, the array indexing
+/// carries no bounds checks, and the empty-input branch folds away. The
+/// two finalization shifts collapse into a single multiply, since
+/// appending both implicit zero bytes scales the sum by 2^16 ≡ 17
+/// (mod 2^16 - 17).
+///
+/// Bit-identical to [`koopman16`] over the same bytes. Useful for
+/// packet formats whose size is known at compile time.
+///
+/// # Arguments
+/// * `data` - The data bytes to checksum
+/// * `initial_seed` - Initial seed value
+///
+/// # Returns
+/// 16-bit checksum value, or 0 if `N` is 0
+///
+/// # Example
+/// ```rust
+/// use koopman_checksum::{koopman16, koopman16_fixed};
+///
+/// let frame = [0xABu8; 48];
+/// assert_eq!(koopman16_fixed(&frame, 0xee), koopman16(&frame, 0xee));
+/// ```
+#[inline]
+#[must_use]
+pub fn koopman16_fixed<const N: usize>(data: &[u8; N], initial_seed: u8) -> u16 {
+    if N == 0 {
+        return 0;
+    }
+
+    let mut sum = (data[0] ^ initial_seed) as u32;
+
+    let words = (N - 1) / 8;
+    for t in 0..words {
+        let base = 1 + t * 8;
+        sum = koopman16_word_step(
+            sum,
+            u64::from_be_bytes(data[base..base + 8].try_into().unwrap()),
+        );
+    }
+
+    // Tail bytes (at most 7, count known at compile time) with delayed
+    // reduction: two bytes fit in the accumulator between reductions
+    let mut i = 1 + words * 8;
+    while i < N {
+        sum = (sum << 8) + data[i] as u32;
+        if i + 1 < N {
+            sum = (sum << 8) + data[i + 1] as u32;
+        }
+        sum = fast_mod_65519(sum);
+        i += 2;
+    }
+
+    koopman16_finalize(sum)
+}
+
+/// Checksum a batch of independent messages, writing into a caller slice.
+///
+/// Messages are processed four at a time with their Horner chains
+/// interleaved, so the serial dependency chains of independent messages
+/// overlap in the CPU pipeline. Results are identical to calling
+/// [`koopman16`] per message; this only helps throughput when many small
+/// messages are checksummed together.
+///
+/// # Arguments
+/// * `msgs` - The messages to checksum
+/// * `initial_seed` - Initial seed value applied to every message
+/// * `out` - Receives one checksum per message, in order
+///
+/// # Panics
+/// Panics if `out` is shorter than `msgs`.
+///
+/// # Example
+/// ```rust
+/// use koopman_checksum::{koopman16, koopman16_batch_into};
+///
+/// let msgs: [&[u8]; 3] = [b"alpha", b"beta", b"gamma"];
+/// let mut out = [0u16; 3];
+/// koopman16_batch_into(&msgs, 0xee, &mut out);
+/// assert_eq!(out[1], koopman16(b"beta", 0xee));
+/// ```
+pub fn koopman16_batch_into(msgs: &[&[u8]], initial_seed: u8, out: &mut [u16]) {
+    assert!(
+        out.len() >= msgs.len(),
+        "output slice shorter than message count"
+    );
+
+    for (group, out) in msgs.chunks(4).zip(out.chunks_mut(4)) {
+        if group.len() == 4 && !group.iter().any(|m| m.is_empty()) {
+            let mut sums = [
+                (group[0][0] ^ initial_seed) as u32,
+                (group[1][0] ^ initial_seed) as u32,
+                (group[2][0] ^ initial_seed) as u32,
+                (group[3][0] ^ initial_seed) as u32,
+            ];
+
+            // Lockstep over the words all four messages still have; the
+            // four chains are independent, so the CPU overlaps them
+            let words = group.iter().map(|m| (m.len() - 1) / 8).min().unwrap();
+            for t in 0..words {
+                let base = 1 + t * 8;
+                sums[0] = koopman16_word_step(
+                    sums[0],
+                    u64::from_be_bytes(group[0][base..base + 8].try_into().unwrap()),
+                );
+                sums[1] = koopman16_word_step(
+                    sums[1],
+                    u64::from_be_bytes(group[1][base..base + 8].try_into().unwrap()),
+                );
+                sums[2] = koopman16_word_step(
+                    sums[2],
+                    u64::from_be_bytes(group[2][base..base + 8].try_into().unwrap()),
+                );
+                sums[3] = koopman16_word_step(
+                    sums[3],
+                    u64::from_be_bytes(group[3][base..base + 8].try_into().unwrap()),
+                );
+            }
+
+            // Uneven lengths drain individually
+            let consumed = 1 + words * 8;
+            for j in 0..4 {
+                out[j] = koopman16_finalize(koopman16_consume(sums[j], &group[j][consumed..]));
+            }
+        } else {
+            for (j, msg) in group.iter().enumerate() {
+                out[j] = koopman16(msg, initial_seed);
+            }
+        }
+    }
+}
+
+/// Checksum a batch of independent messages.
+///
+/// Allocating convenience wrapper around [`koopman16_batch_into`].
+///
+/// # Arguments
+/// * `msgs` - The messages to checksum
+/// * `initial_seed` - Initial seed value applied to every message
+///
+/// # Returns
+/// One checksum per message, in order
+///
+/// # Example
+/// ```rust
+/// use koopman_checksum::{koopman16, koopman16_batch};
+///
+/// let msgs: [&[u8]; 2] = [b"alpha", b"beta"];
+/// let checksums = koopman16_batch(&msgs, 0xee);
+/// assert_eq!(checksums, vec![koopman16(b"alpha", 0xee), koopman16(b"beta", 0xee)]);
+/// ```
+#[cfg(feature = "std")]
+#[must_use]
+pub fn koopman16_batch(msgs: &[&[u8]], initial_seed: u8) -> Vec<u16> {
+    let mut out = vec![0u16; msgs.len()];
+    koopman16_batch_into(msgs, initial_seed, &mut out);
+    out
 }
 
 /// Compute a 16-bit Koopman checksum with a custom modulus.
@@ -217,15 +754,16 @@ pub fn koopman16_with_modulus(data: &[u8], initial_seed: u8, modulus: NonZeroU32
     }
 
     let modulus = modulus.get();
+    let rcp = barrett_rcp_u32(modulus);
     let mut sum: u32 = (data[0] ^ initial_seed) as u32;
 
     for &byte in &data[1..] {
-        sum = ((sum << 8) + byte as u32) % modulus;
+        sum = barrett_mod_u32((sum << 8) + byte as u32, modulus, rcp);
     }
 
     // Append two implicit zero bytes
-    sum = (sum << 8) % modulus;
-    sum = (sum << 8) % modulus;
+    sum = barrett_mod_u32(sum << 8, modulus, rcp);
+    sum = barrett_mod_u32(sum << 8, modulus, rcp);
 
     sum as u16
 }
@@ -234,6 +772,10 @@ pub fn koopman16_with_modulus(data: &[u8], initial_seed: u8, modulus: NonZeroU32
 ///
 /// Detects all 1-bit and 2-bit errors for data up to 134,217,720 bytes.
 ///
+/// With the `simd` feature, buffers of at least `simd::SIMD_THRESHOLD`
+/// bytes dispatch to the best kernel for the host CPU; see
+/// [`selected_kernel`].
+///
 /// # Arguments
 /// * `data` - The data bytes to checksum
 /// * `initial_seed` - Initial seed value
@@ -255,20 +797,123 @@ pub fn koopman32(data: &[u8], initial_seed: u8) -> u32 {
         return 0;
     }
 
-    let mut sum: u64 = (data[0] ^ initial_seed) as u64;
+    #[cfg(all(feature = "simd", target_arch = "x86_64"))]
+    if data.len() >= simd::SIMD_THRESHOLD && selected_kernel() == Kernel::Avx2 {
+        if let Some(checksum) = simd::koopman32(data, initial_seed) {
+            return checksum;
+        }
+    }
 
-    // Use fast modular reduction for the default modulus
-    for &byte in &data[1..] {
+    let sum = koopman32_consume((data[0] ^ initial_seed) as u64, &data[1..]);
+    koopman32_finalize(sum)
+}
+
+/// One word-kernel Horner step: advance `sum` across an 8-byte big-endian
+/// word. The Horner recurrence over a whole word is
+/// sum = sum * 256^8 + word, and since 2^32 ≡ 5 (mod 2^32 - 5),
+/// 256^8 = 2^64 ≡ 25. Folding the word's high half the same way keeps the
+/// accumulator under 2^37, well within fast_mod_4294967291's input bound,
+/// so one reduction per word suffices. This breaks the byte-serial
+/// dependency chain: one multiply, one fold, and one reduction cover
+/// 8 bytes.
+#[inline(always)]
+fn koopman32_word_step(sum: u64, word: u64) -> u64 {
+    let folded = (word >> 32) * 5 + (word & 0xFFFFFFFF);
+    fast_mod_4294967291(sum * 25 + folded)
+}
+
+/// Advance a Koopman32 accumulator across `body`: whole 8-byte words
+/// through the word kernel, tail bytes one at a time.
+#[inline]
+fn koopman32_consume(mut sum: u64, body: &[u8]) -> u64 {
+    let mut chunks = body.chunks_exact(8);
+    for chunk in chunks.by_ref() {
+        sum = koopman32_word_step(sum, u64::from_be_bytes(chunk.try_into().unwrap()));
+    }
+
+    // Tail bytes use the byte-at-a-time recurrence
+    for &byte in chunks.remainder() {
         sum = fast_mod_4294967291((sum << 8) + byte as u64);
     }
+    sum
+}
 
-    // Append four implicit zero bytes
-    sum = fast_mod_4294967291(sum << 8);
-    sum = fast_mod_4294967291(sum << 8);
-    sum = fast_mod_4294967291(sum << 8);
-    sum = fast_mod_4294967291(sum << 8);
+/// Append the four implicit zero bytes and narrow to the output width.
+/// All four shifts collapse into one multiply: 2^32 ≡ 5 (mod 2^32 - 5).
+#[inline(always)]
+fn koopman32_finalize(sum: u64) -> u32 {
+    fast_mod_4294967291(sum * 5) as u32
+}
 
-    sum as u32
+/// Compute a 32-bit Koopman checksum over non-contiguous segments.
+///
+/// The 32-bit counterpart of [`koopman16_vectored`]: bit-identical to
+/// [`koopman32`] over the concatenation of the segments, with word
+/// alignment carried across segment boundaries so no scratch copy of the
+/// message is needed.
+///
+/// # Arguments
+/// * `bufs` - The message segments, in order
+/// * `initial_seed` - Initial seed value
+///
+/// # Returns
+/// 32-bit checksum value, or 0 if all segments are empty
+///
+/// # Example
+/// ```rust
+/// use koopman_checksum::{koopman32, koopman32_vectored};
+///
+/// let segments: [&[u8]; 3] = [b"head", b"er and ", b"body"];
+/// assert_eq!(
+///     koopman32_vectored(&segments, 0xee),
+///     koopman32(b"header and body", 0xee)
+/// );
+/// ```
+#[must_use]
+pub fn koopman32_vectored<B: AsRef<[u8]>>(bufs: &[B], initial_seed: u8) -> u32 {
+    let mut sum = 0u64;
+    let mut started = false;
+    let mut carry = [0u8; 8];
+    let mut carry_len = 0usize;
+
+    for buf in bufs {
+        let mut seg = buf.as_ref();
+        if seg.is_empty() {
+            continue;
+        }
+        if !started {
+            sum = (seg[0] ^ initial_seed) as u64;
+            started = true;
+            seg = &seg[1..];
+        }
+
+        // Top up the straddling word with this segment's leading bytes
+        if carry_len > 0 {
+            let take = (8 - carry_len).min(seg.len());
+            carry[carry_len..carry_len + take].copy_from_slice(&seg[..take]);
+            carry_len += take;
+            seg = &seg[take..];
+            if carry_len < 8 {
+                continue;
+            }
+            sum = koopman32_word_step(sum, u64::from_be_bytes(carry));
+        }
+
+        let mut chunks = seg.chunks_exact(8);
+        for chunk in chunks.by_ref() {
+            sum = koopman32_word_step(sum, u64::from_be_bytes(chunk.try_into().unwrap()));
+        }
+
+        // Stage the tail; the next segment may complete the word
+        let rem = chunks.remainder();
+        carry[..rem.len()].copy_from_slice(rem);
+        carry_len = rem.len();
+    }
+
+    if !started {
+        return 0;
+    }
+    koopman32_finalize(koopman32_consume(sum, &carry[..carry_len]))
 }
 
 /// Compute a 32-bit Koopman checksum with a custom modulus.
@@ -297,62 +942,375 @@ pub fn koopman32_with_modulus(data: &[u8], initial_seed: u8, modulus: NonZeroU64
     }
 
     let modulus = modulus.get();
+    let rcp = barrett_rcp_u64(modulus);
     let mut sum: u64 = (data[0] ^ initial_seed) as u64;
 
     for &byte in &data[1..] {
-        sum = ((sum << 8) + byte as u64) % modulus;
+        sum = barrett_mod_u64((sum << 8) + byte as u64, modulus, rcp);
     }
 
     // Append four implicit zero bytes
-    sum = (sum << 8) % modulus;
-    sum = (sum << 8) % modulus;
-    sum = (sum << 8) % modulus;
-    sum = (sum << 8) % modulus;
+    sum = barrett_mod_u64(sum << 8, modulus, rcp);
+    sum = barrett_mod_u64(sum << 8, modulus, rcp);
+    sum = barrett_mod_u64(sum << 8, modulus, rcp);
+    sum = barrett_mod_u64(sum << 8, modulus, rcp);
 
     sum as u32
 }
 
-// ============================================================================
-// Parity Variants (HD=4)
-// ============================================================================
-
-/// Compute parity of a byte (number of set bits mod 2).
-#[inline]
-fn parity8(x: u8) -> u8 {
-    (x.count_ones() & 1) as u8
-}
-
-/// Compute an 8-bit Koopman checksum with parity (7-bit checksum + 1 parity bit).
+/// Compute a 64-bit Koopman checksum.
 ///
-/// Detects all 1-bit, 2-bit, and 3-bit errors for data up to 5 bytes.
-/// Uses modulus 125 for the 7-bit checksum portion.
+/// Detects all 1-bit and 2-bit errors for data far beyond the 32-bit
+/// variant's 134 MB limit, keeping whole-object checks of multi-gigabyte
+/// archives a single pass. Uses modulus 2^64 - 59, the largest 64-bit
+/// prime; no custom-modulus variant is offered at this width.
 ///
 /// # Arguments
 /// * `data` - The data bytes to checksum
 /// * `initial_seed` - Initial seed value
 ///
 /// # Returns
-/// 8-bit value: 7-bit checksum in upper bits, parity in LSB, or 0 if data is empty
+/// 64-bit checksum value, or 0 if data is empty
 ///
 /// # Example
 /// ```rust
-/// use koopman_checksum::koopman8p;
+/// use koopman_checksum::koopman64;
 ///
-/// let checksum = koopman8p(b"test", 0xee);
-/// let parity_bit = checksum & 1;
-/// let checksum_bits = checksum >> 1;
+/// let checksum = koopman64(b"test data", 0xee);
+/// assert_eq!(koopman64(&[], 0xee), 0); // Empty data returns 0
 /// ```
 #[inline]
 #[must_use]
-pub fn koopman8p(data: &[u8], initial_seed: u8) -> u8 {
-    koopman8p_with_modulus(data, initial_seed, NONZERO_MODULUS_7P)
+pub fn koopman64(data: &[u8], initial_seed: u8) -> u64 {
+    if data.is_empty() {
+        return 0;
+    }
+
+    let mut sum: u64 = (data[0] ^ initial_seed) as u64;
+
+    // Process 8 bytes per iteration: 2^64 ≡ 59 (mod 2^64 - 59), so the
+    // per-word Horner factor 256^8 = 2^64 collapses to 59 and the whole
+    // word adds in directly. One widened multiply and one reduction cover
+    // 8 bytes, mirroring the koopman32 kernel.
+    let mut chunks = data[1..].chunks_exact(8);
+    for chunk in chunks.by_ref() {
+        let word = u64::from_be_bytes(chunk.try_into().unwrap());
+        sum = fast_mod_18446744073709551557(sum as u128 * 59 + word as u128);
+    }
+
+    // Tail bytes use the byte-at-a-time recurrence
+    for &byte in chunks.remainder() {
+        sum = fast_mod_18446744073709551557(((sum as u128) << 8) + byte as u128);
+    }
+
+    // Append all eight implicit zero bytes in one step:
+    // 2^64 ≡ 59 (mod 2^64 - 59)
+    sum = fast_mod_18446744073709551557(sum as u128 * 59);
+
+    sum
 }
 
-/// Compute an 8-bit Koopman checksum with parity using a custom modulus.
+/// Incremental Koopman64 checksum calculator.
 ///
-/// # Arguments
-/// * `data` - The data bytes to checksum
-/// * `initial_seed` - Initial seed value
+/// Allows computing checksums over data that arrives in chunks. Always
+/// uses the default modulus [`MODULUS_64`].
+///
+/// # Example
+/// ```rust
+/// use koopman_checksum::Koopman64;
+///
+/// let mut hasher = Koopman64::new();
+/// hasher.update(b"Hello, ");
+/// hasher.update(b"World!");
+/// let checksum = hasher.finalize();
+/// ```
+#[derive(Clone, Debug)]
+pub struct Koopman64 {
+    sum: u64,
+    seed: u64,
+    initialized: bool,
+    #[cfg(feature = "telemetry")]
+    stats: crate::telemetry::HasherStats,
+}
+
+impl Default for Koopman64 {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+impl Koopman64 {
+    /// Create a new hasher.
+    #[inline]
+    pub fn new() -> Self {
+        Self {
+            sum: 0,
+            seed: 0,
+            initialized: false,
+            #[cfg(feature = "telemetry")]
+            stats: crate::telemetry::HasherStats::default(),
+        }
+    }
+
+    /// Create a new hasher with an initial seed.
+    ///
+    /// # Example
+    /// ```rust
+    /// use koopman_checksum::Koopman64;
+    ///
+    /// let hasher = Koopman64::with_seed(0xee);
+    /// ```
+    #[inline]
+    pub fn with_seed(seed: u8) -> Self {
+        Self {
+            sum: seed as u64,
+            seed: seed as u64,
+            initialized: false,
+            #[cfg(feature = "telemetry")]
+            stats: crate::telemetry::HasherStats::default(),
+        }
+    }
+
+    /// Cold prologue for the first byte ever fed: fold it into the seed
+    /// and return the remainder. Out of line so the steady-state update
+    /// loop is a branch-free slice walk.
+    #[cold]
+    fn init_first_byte<'a>(&mut self, data: &'a [u8]) -> &'a [u8] {
+        self.sum ^= data[0] as u64;
+        self.initialized = true;
+        &data[1..]
+    }
+
+    /// Update the checksum with more data.
+    #[inline]
+    pub fn update(&mut self, data: &[u8]) {
+        if data.is_empty() {
+            return;
+        }
+
+        // Once per call, not per byte: the counters stay off the byte
+        // loop's dependency chain. Koopman64 has no Barrett fallback, so
+        // every byte is fast-kernel
+        #[cfg(feature = "telemetry")]
+        {
+            self.stats.update_calls += 1;
+            self.stats.bytes += data.len() as u64;
+            crate::telemetry::record_update(data.len(), true);
+        }
+
+        let body = if self.initialized {
+            data
+        } else {
+            self.init_first_byte(data)
+        };
+
+        for &byte in body {
+            self.sum = fast_mod_18446744073709551557(((self.sum as u128) << 8) + byte as u128);
+        }
+    }
+
+    /// Update the checksum as if `n` zero bytes had been provided.
+    ///
+    /// A run of n zero bytes scales the Horner sum by 256^n mod m, so the
+    /// run collapses to one modular exponentiation and one multiply —
+    /// O(log n) instead of O(n). Produces the same state as
+    /// `update(&[0u8; n])`. Useful for sparse data where long zero runs
+    /// are known without materializing them.
+    ///
+    /// # Example
+    /// ```rust
+    /// use koopman_checksum::{koopman64, Koopman64};
+    ///
+    /// let mut hasher = Koopman64::new();
+    /// hasher.update(b"header");
+    /// hasher.update_zeros(4096); // a zero page, skipped symbolically
+    /// hasher.update(b"trailer");
+    ///
+    /// let mut data = b"header".to_vec();
+    /// data.extend_from_slice(&[0u8; 4096]);
+    /// data.extend_from_slice(b"trailer");
+    /// assert_eq!(hasher.finalize(), koopman64(&data, 0));
+    /// ```
+    #[inline]
+    pub fn update_zeros(&mut self, mut n: usize) {
+        if n == 0 {
+            return;
+        }
+        if !self.initialized {
+            // The first byte is XORed with the seed, and a zero byte
+            // leaves the seed unchanged
+            self.initialized = true;
+            n -= 1;
+        }
+        let factor = pow_256_mod(n, MODULUS_64 as u64);
+        self.sum = ((self.sum as u128 * factor as u128) % MODULUS_64) as u64;
+    }
+
+    /// Finalize and return the checksum.
+    ///
+    /// Returns 0 if no data was provided.
+    #[inline]
+    #[must_use]
+    pub fn finalize(self) -> u64 {
+        if !self.initialized {
+            return 0;
+        }
+        // The eight implicit zero bytes scale the sum by
+        // 2^64 ≡ 59 (mod 2^64 - 59)
+        fast_mod_18446744073709551557(self.sum as u128 * 59)
+    }
+
+    /// Reset the hasher to initial state.
+    #[inline]
+    pub fn reset(&mut self) {
+        self.sum = self.seed;
+        self.initialized = false;
+    }
+
+    /// Per-hasher telemetry counters (the `telemetry` feature).
+    ///
+    /// Counts `update` calls and bytes fed to this hasher alone;
+    /// process-wide totals live in [`crate::telemetry`]. Not cleared by
+    /// [`reset`](Self::reset) and not part of [`state`](Koopman64::state).
+    #[cfg(feature = "telemetry")]
+    #[must_use]
+    pub fn stats(&self) -> crate::telemetry::HasherStats {
+        self.stats
+    }
+
+    /// Size in bytes of the serialized state returned by
+    /// [`state`](Koopman64::state): sum, seed byte, initialized flag.
+    /// The modulus is fixed, so it is not stored.
+    pub const STATE_SIZE: usize = 10;
+
+    /// Capture the hasher's state for checkpointing.
+    ///
+    /// Together with [`from_state`](Koopman64::from_state), lets a
+    /// long-running stream resume after a crash without re-hashing the
+    /// bytes already consumed: persist these few bytes alongside the
+    /// resume offset. The layout is fixed (big-endian) and stable across
+    /// processes.
+    ///
+    /// # Example
+    /// ```rust
+    /// use koopman_checksum::Koopman64;
+    ///
+    /// let mut hasher = Koopman64::new();
+    /// hasher.update(b"Hello, ");
+    /// let saved = hasher.state();
+    ///
+    /// let mut resumed = Koopman64::from_state(&saved).unwrap();
+    /// resumed.update(b"World!");
+    /// hasher.update(b"World!");
+    /// assert_eq!(resumed.finalize(), hasher.finalize());
+    /// ```
+    #[must_use]
+    pub fn state(&self) -> [u8; Self::STATE_SIZE] {
+        let mut out = [0u8; Self::STATE_SIZE];
+        out[..8].copy_from_slice(&self.sum.to_be_bytes());
+        out[8] = self.seed as u8;
+        out[9] = self.initialized as u8;
+        out
+    }
+
+    /// Reconstruct a hasher from bytes captured by
+    /// [`state`](Koopman64::state).
+    ///
+    /// # Returns
+    /// The hasher, or `None` if the flag byte is out of range
+    #[must_use]
+    pub fn from_state(state: &[u8; Self::STATE_SIZE]) -> Option<Self> {
+        if state[9] > 1 {
+            return None;
+        }
+        Some(Self {
+            sum: u64::from_be_bytes(state[..8].try_into().unwrap()),
+            seed: state[8] as u64,
+            initialized: state[9] == 1,
+            #[cfg(feature = "telemetry")]
+            stats: crate::telemetry::HasherStats::default(),
+        })
+    }
+}
+
+// ============================================================================
+// Parity Variants (HD=4)
+// ============================================================================
+
+/// Compute parity of a byte (number of set bits mod 2).
+#[inline]
+fn parity8(x: u8) -> u8 {
+    (x.count_ones() & 1) as u8
+}
+
+/// XOR of every byte in `data`: eight bytes at a time, then a horizontal
+/// fold. Computing the parity byte in its own wide pass keeps it off the
+/// modular sum's serial dependency chain.
+#[inline]
+fn xor_fold(data: &[u8]) -> u8 {
+    let mut chunks = data.chunks_exact(8);
+    let mut acc: u64 = 0;
+    for chunk in chunks.by_ref() {
+        acc ^= u64::from_ne_bytes(chunk.try_into().unwrap());
+    }
+    acc ^= acc >> 32;
+    acc ^= acc >> 16;
+    acc ^= acc >> 8;
+
+    let mut psum = acc as u8;
+    for &byte in chunks.remainder() {
+        psum ^= byte;
+    }
+    psum
+}
+
+/// Compute an 8-bit Koopman checksum with parity (7-bit checksum + 1 parity bit).
+///
+/// Detects all 1-bit, 2-bit, and 3-bit errors for data up to 5 bytes.
+/// Uses modulus 125 for the 7-bit checksum portion.
+///
+/// # Arguments
+/// * `data` - The data bytes to checksum
+/// * `initial_seed` - Initial seed value
+///
+/// # Returns
+/// 8-bit value: 7-bit checksum in upper bits, parity in LSB, or 0 if data is empty
+///
+/// # Example
+/// ```rust
+/// use koopman_checksum::koopman8p;
+///
+/// let checksum = koopman8p(b"test", 0xee);
+/// let parity_bit = checksum & 1;
+/// let checksum_bits = checksum >> 1;
+/// ```
+#[inline]
+#[must_use]
+pub fn koopman8p(data: &[u8], initial_seed: u8) -> u8 {
+    if data.is_empty() {
+        return 0;
+    }
+
+    let first = data[0] ^ initial_seed;
+    let mut sum = first as u32;
+    for &byte in &data[1..] {
+        sum = fast_mod_125((sum << 8) + byte as u32);
+    }
+
+    // Append the implicit zero byte in one step: 256 ≡ 6 (mod 125)
+    sum = fast_mod_125(sum * 6);
+
+    // Pack: checksum in upper 7 bits, parity in LSB
+    // Parity covers the same byte stream as the checksum core, i.e. data[0] ^ seed
+    let psum = first ^ xor_fold(&data[1..]);
+    ((sum as u8) << 1) | parity8(psum)
+}
+
+/// Compute an 8-bit Koopman checksum with parity using a custom modulus.
+///
+/// # Arguments
+/// * `data` - The data bytes to checksum
+/// * `initial_seed` - Initial seed value
 /// * `modulus` - The modulus for the 7-bit checksum. Must be non-zero and <= 127.
 ///
 /// # Returns
@@ -374,19 +1332,20 @@ pub fn koopman8p_with_modulus(data: &[u8], initial_seed: u8, modulus: NonZeroU32
     }
 
     let modulus = modulus.get();
-    let mut sum: u32 = (data[0] ^ initial_seed) as u32;
-    let mut psum: u8 = sum as u8;
+    let rcp = barrett_rcp_u32(modulus);
+    let first = data[0] ^ initial_seed;
+    let mut sum: u32 = first as u32;
 
     for &byte in &data[1..] {
-        sum = ((sum << 8) + byte as u32) % modulus;
-        psum ^= byte;
+        sum = barrett_mod_u32((sum << 8) + byte as u32, modulus, rcp);
     }
 
     // Append implicit zero byte
-    sum = (sum << 8) % modulus;
+    sum = barrett_mod_u32(sum << 8, modulus, rcp);
 
     // Pack: checksum in upper 7 bits, parity in LSB
     // Parity covers the same byte stream as the checksum core, i.e. data[0] ^ seed
+    let psum = first ^ xor_fold(&data[1..]);
     ((sum as u8) << 1) | parity8(psum)
 }
 
@@ -413,7 +1372,23 @@ pub fn koopman8p_with_modulus(data: &[u8], initial_seed: u8, modulus: NonZeroU32
 #[inline]
 #[must_use]
 pub fn koopman16p(data: &[u8], initial_seed: u8) -> u16 {
-    koopman16p_with_modulus(data, initial_seed, NONZERO_MODULUS_15P)
+    if data.is_empty() {
+        return 0;
+    }
+
+    let first = data[0] ^ initial_seed;
+    let mut sum = first as u32;
+    for &byte in &data[1..] {
+        sum = fast_mod_32749((sum << 8) + byte as u32);
+    }
+
+    // Append both implicit zero bytes in one step: 2^16 ≡ 38 (mod 2^15 - 19)
+    sum = fast_mod_32749(sum * 38);
+
+    // Pack: checksum in upper 15 bits, parity in LSB
+    // Parity covers the same byte stream as the checksum core, i.e. data[0] ^ seed
+    let psum = first ^ xor_fold(&data[1..]);
+    ((sum as u16) << 1) | (parity8(psum) as u16)
 }
 
 /// Compute a 16-bit Koopman checksum with parity using a custom modulus.
@@ -442,20 +1417,21 @@ pub fn koopman16p_with_modulus(data: &[u8], initial_seed: u8, modulus: NonZeroU3
     }
 
     let modulus = modulus.get();
-    let mut sum: u32 = (data[0] ^ initial_seed) as u32;
-    let mut psum: u8 = sum as u8;
+    let rcp = barrett_rcp_u32(modulus);
+    let first = data[0] ^ initial_seed;
+    let mut sum: u32 = first as u32;
 
     for &byte in &data[1..] {
-        sum = ((sum << 8) + byte as u32) % modulus;
-        psum ^= byte;
+        sum = barrett_mod_u32((sum << 8) + byte as u32, modulus, rcp);
     }
 
     // Append two implicit zero bytes
-    sum = (sum << 8) % modulus;
-    sum = (sum << 8) % modulus;
+    sum = barrett_mod_u32(sum << 8, modulus, rcp);
+    sum = barrett_mod_u32(sum << 8, modulus, rcp);
 
     // Pack: checksum in upper 15 bits, parity in LSB
     // Parity covers the same byte stream as the checksum core, i.e. data[0] ^ seed
+    let psum = first ^ xor_fold(&data[1..]);
     ((sum as u16) << 1) | (parity8(psum) as u16)
 }
 
@@ -482,7 +1458,39 @@ pub fn koopman16p_with_modulus(data: &[u8], initial_seed: u8, modulus: NonZeroU3
 #[inline]
 #[must_use]
 pub fn koopman32p(data: &[u8], initial_seed: u8) -> u32 {
-    koopman32p_with_modulus(data, initial_seed, NONZERO_MODULUS_31P)
+    if data.is_empty() {
+        return 0;
+    }
+
+    let first = data[0] ^ initial_seed;
+    let mut sum: u64 = first as u64;
+
+    // Process 8 bytes per iteration, mirroring the koopman32 kernel:
+    // 2^31 ≡ 19 (mod 2^31 - 19), so the per-word Horner factor
+    // 256^8 = 2^64 ≡ 4 * 19^2 = 1444 and the word's high half folds in
+    // with 2^32 ≡ 38. The accumulator stays under 2^42, within
+    // fast_mod_2147483629's input bound, so one reduction per word
+    // suffices.
+    let mut chunks = data[1..].chunks_exact(8);
+    for chunk in chunks.by_ref() {
+        let word = u64::from_be_bytes(chunk.try_into().unwrap());
+        let folded = (word >> 32) * 38 + (word & 0xFFFFFFFF);
+        sum = fast_mod_2147483629(sum * 1444 + folded);
+    }
+
+    // Tail bytes use the byte-at-a-time recurrence
+    for &byte in chunks.remainder() {
+        sum = fast_mod_2147483629((sum << 8) + byte as u64);
+    }
+
+    // Append all four implicit zero bytes in one step:
+    // 2^32 ≡ 38 (mod 2^31 - 19)
+    sum = fast_mod_2147483629(sum * 38);
+
+    // Pack: checksum in upper 31 bits, parity in LSB
+    // Parity covers the same byte stream as the checksum core, i.e. data[0] ^ seed
+    let psum = first ^ xor_fold(&data[1..]);
+    ((sum as u32) << 1) | (parity8(psum) as u32)
 }
 
 /// Compute a 32-bit Koopman checksum with parity using a custom modulus.
@@ -511,296 +1519,2131 @@ pub fn koopman32p_with_modulus(data: &[u8], initial_seed: u8, modulus: NonZeroU6
     }
 
     let modulus = modulus.get();
-    let mut sum: u64 = (data[0] ^ initial_seed) as u64;
-    let mut psum: u8 = sum as u8;
+    let rcp = barrett_rcp_u64(modulus);
+    let first = data[0] ^ initial_seed;
+    let mut sum: u64 = first as u64;
 
     for &byte in &data[1..] {
-        sum = ((sum << 8) + byte as u64) % modulus;
-        psum ^= byte;
+        sum = barrett_mod_u64((sum << 8) + byte as u64, modulus, rcp);
     }
 
     // Append four implicit zero bytes
-    sum = (sum << 8) % modulus;
-    sum = (sum << 8) % modulus;
-    sum = (sum << 8) % modulus;
-    sum = (sum << 8) % modulus;
+    sum = barrett_mod_u64(sum << 8, modulus, rcp);
+    sum = barrett_mod_u64(sum << 8, modulus, rcp);
+    sum = barrett_mod_u64(sum << 8, modulus, rcp);
+    sum = barrett_mod_u64(sum << 8, modulus, rcp);
 
     // Pack: checksum in upper 31 bits, parity in LSB
     // Parity covers the same byte stream as the checksum core, i.e. data[0] ^ seed
+    let psum = first ^ xor_fold(&data[1..]);
     ((sum as u32) << 1) | (parity8(psum) as u32)
 }
 
 // ============================================================================
-// Streaming/Incremental API
+// Compile-Time Evaluation
+//
+// The algorithm is pure integer arithmetic, so checksums of static data can
+// be folded into the binary instead of computed at boot or spliced in by a
+// build-step tool. These `const fn` twins of the one-shot functions trade
+// the runtime kernels (lookup table, Barrett, word-at-a-time) for a plain
+// Horner loop with `%` — free at runtime, and CTFE cost only scales with
+// the blob size. For data only known at runtime, the non-const one-shots
+// are strictly faster.
 // ============================================================================
 
-/// Macro to generate streaming checksum structs.
-/// This reduces code duplication across Koopman8, Koopman16, Koopman32.
-macro_rules! impl_streaming_hasher {
-    (
-        $name:ident,
-        $sum_type:ty,
-        $output_type:ty,
-        $default_modulus_raw:expr,
-        $nonzero_type:ty,
-        $finalize_shifts:expr,
-        $fast_mod:expr
-    ) => {
-        impl Default for $name {
-            fn default() -> Self {
-                Self::new()
-            }
+/// Horner core shared by the `const fn` one-shots: seed fold, byte loop,
+/// and the implicit zero-byte finalization, all in u128 so one helper
+/// covers every modulus up to [`MODULUS_64`]. Returns 0 for empty data.
+const fn horner_mod_const(data: &[u8], seed: u8, modulus: u128, zero_bytes: u32) -> u128 {
+    if data.is_empty() {
+        return 0;
+    }
+    let mut sum = (data[0] ^ seed) as u128;
+    let mut i = 1;
+    while i < data.len() {
+        sum = ((sum << 8) + data[i] as u128) % modulus;
+        i += 1;
+    }
+    let mut k = 0;
+    while k < zero_bytes {
+        sum = (sum << 8) % modulus;
+        k += 1;
+    }
+    sum
+}
+
+/// XOR of every byte with the first folded into the seed — the parity
+/// byte the `P` variants cover, as a `const fn`.
+const fn xor_all_const(data: &[u8], seed: u8) -> u8 {
+    let mut psum = seed;
+    let mut i = 0;
+    while i < data.len() {
+        psum ^= data[i];
+        i += 1;
+    }
+    psum
+}
+
+/// Compute an 8-bit Koopman checksum in a `const` context.
+///
+/// Identical results to [`koopman8`]; see the module note on when to
+/// prefer the runtime version.
+#[must_use]
+pub const fn koopman8_const(data: &[u8], initial_seed: u8) -> u8 {
+    horner_mod_const(data, initial_seed, MODULUS_8 as u128, 1) as u8
+}
+
+/// Compute a 16-bit Koopman checksum in a `const` context.
+///
+/// Identical results to [`koopman16`], evaluated by the compiler when
+/// the data is static — embedded configuration blobs can carry their
+/// checksum without a build-step tool or boot-time pass.
+///
+/// # Example
+/// ```rust
+/// use koopman_checksum::{koopman16, koopman16_const};
+///
+/// const CFG_BLOB: &[u8] = b"threshold=42\n";
+/// const CFG_CS: u16 = koopman16_const(CFG_BLOB, 0);
+/// assert_eq!(CFG_CS, koopman16(CFG_BLOB, 0));
+/// ```
+#[must_use]
+pub const fn koopman16_const(data: &[u8], initial_seed: u8) -> u16 {
+    horner_mod_const(data, initial_seed, MODULUS_16 as u128, 2) as u16
+}
+
+/// Compute a 32-bit Koopman checksum in a `const` context.
+///
+/// Identical results to [`koopman32`]; see the module note on when to
+/// prefer the runtime version.
+#[must_use]
+pub const fn koopman32_const(data: &[u8], initial_seed: u8) -> u32 {
+    horner_mod_const(data, initial_seed, MODULUS_32 as u128, 4) as u32
+}
+
+/// Compute a 64-bit Koopman checksum in a `const` context.
+///
+/// Identical results to [`koopman64`]; see the module note on when to
+/// prefer the runtime version.
+#[must_use]
+pub const fn koopman64_const(data: &[u8], initial_seed: u8) -> u64 {
+    horner_mod_const(data, initial_seed, MODULUS_64, 8) as u64
+}
+
+/// Compute an 8-bit Koopman checksum with parity in a `const` context.
+///
+/// Identical results to [`koopman8p`]; see the module note on when to
+/// prefer the runtime version.
+#[must_use]
+pub const fn koopman8p_const(data: &[u8], initial_seed: u8) -> u8 {
+    if data.is_empty() {
+        return 0;
+    }
+    let sum = horner_mod_const(data, initial_seed, MODULUS_7P as u128, 1) as u8;
+    let parity = (xor_all_const(data, initial_seed).count_ones() & 1) as u8;
+    (sum << 1) | parity
+}
+
+/// Compute a 16-bit Koopman checksum with parity in a `const` context.
+///
+/// Identical results to [`koopman16p`]; see the module note on when to
+/// prefer the runtime version.
+///
+/// # Example
+/// ```rust
+/// use koopman_checksum::{koopman16p, koopman16p_const};
+///
+/// const CFG_BLOB: &[u8] = b"threshold=42\n";
+/// const CFG_CS: u16 = koopman16p_const(CFG_BLOB, 0);
+/// assert_eq!(CFG_CS, koopman16p(CFG_BLOB, 0));
+/// ```
+#[must_use]
+pub const fn koopman16p_const(data: &[u8], initial_seed: u8) -> u16 {
+    if data.is_empty() {
+        return 0;
+    }
+    let sum = horner_mod_const(data, initial_seed, MODULUS_15P as u128, 2) as u16;
+    let parity = (xor_all_const(data, initial_seed).count_ones() & 1) as u16;
+    (sum << 1) | parity
+}
+
+/// Compute a 32-bit Koopman checksum with parity in a `const` context.
+///
+/// Identical results to [`koopman32p`]; see the module note on when to
+/// prefer the runtime version.
+#[must_use]
+pub const fn koopman32p_const(data: &[u8], initial_seed: u8) -> u32 {
+    if data.is_empty() {
+        return 0;
+    }
+    let sum = horner_mod_const(data, initial_seed, MODULUS_31P as u128, 4) as u32;
+    let parity = (xor_all_const(data, initial_seed).count_ones() & 1) as u32;
+    (sum << 1) | parity
+}
+
+// ============================================================================
+// Checksum Combination
+//
+// The Horner form sum = Σ data[i] * 256^(len-1-i) mod m is linear, so the
+// checksum of a concatenation A||B follows from the two parts alone:
+//
+//   checksum(A||B) = checksum(A) * 256^len(B) + checksum(B)  (mod m)
+//
+// The implicit-zero finalization distributes over both sides (each part's
+// checksum already carries the same 256^k finalization factor), so the
+// identity holds directly on finalized values. This lets shards of a large
+// object be checksummed independently and merged.
+// ============================================================================
+
+/// Compute 256^exp mod modulus by binary exponentiation.
+pub(crate) fn pow_256_mod(exp: usize, modulus: u64) -> u64 {
+    let mut result: u64 = 1 % modulus;
+    let mut base: u64 = 256 % modulus;
+    let mut e = exp;
+    while e > 0 {
+        if e & 1 == 1 {
+            result = ((result as u128 * base as u128) % modulus as u128) as u64;
         }
+        base = ((base as u128 * base as u128) % modulus as u128) as u64;
+        e >>= 1;
+    }
+    result
+}
 
-        impl $name {
-            /// Create a new hasher with the default modulus.
-            #[inline]
-            pub fn new() -> Self {
-                Self {
-                    sum: 0,
-                    modulus: $default_modulus_raw,
-                    seed: 0,
-                    initialized: false,
-                    use_fast_mod: true,
-                }
+/// Combine two independently computed Koopman8 checksums.
+///
+/// Produces the checksum of the concatenation A||B from the checksums of the
+/// two parts. The first part carries the overall seed; every subsequent part
+/// must be computed with seed 0.
+///
+/// # Arguments
+/// * `cs_a` - Checksum of the first part (computed with the overall seed)
+/// * `cs_b` - Checksum of the second part (computed with seed 0)
+/// * `len_b` - Length of the second part in bytes
+///
+/// # Returns
+/// The checksum of the concatenated data
+///
+/// # Example
+/// ```rust
+/// use koopman_checksum::{koopman8, koopman8_combine};
+///
+/// let (a, b) = (b"part ".as_slice(), b"two".as_slice());
+/// let combined = koopman8_combine(koopman8(a, 0xee), koopman8(b, 0), b.len());
+/// assert_eq!(combined, koopman8(&[a, b].concat(), 0xee));
+/// ```
+#[must_use]
+pub fn koopman8_combine(cs_a: u8, cs_b: u8, len_b: usize) -> u8 {
+    let pow = pow_256_mod(len_b, MODULUS_8 as u64) as u32;
+    ((cs_a as u32 * pow + cs_b as u32) % MODULUS_8) as u8
+}
+
+/// Combine two independently computed Koopman16 checksums.
+///
+/// Produces the checksum of the concatenation A||B from the checksums of the
+/// two parts. The first part carries the overall seed; every subsequent part
+/// must be computed with seed 0.
+///
+/// # Arguments
+/// * `cs_a` - Checksum of the first part (computed with the overall seed)
+/// * `cs_b` - Checksum of the second part (computed with seed 0)
+/// * `len_b` - Length of the second part in bytes
+///
+/// # Returns
+/// The checksum of the concatenated data
+///
+/// # Example
+/// ```rust
+/// use koopman_checksum::{koopman16, koopman16_combine};
+///
+/// let (a, b) = (b"part ".as_slice(), b"two".as_slice());
+/// let combined = koopman16_combine(koopman16(a, 0xee), koopman16(b, 0), b.len());
+/// assert_eq!(combined, koopman16(&[a, b].concat(), 0xee));
+/// ```
+#[must_use]
+pub fn koopman16_combine(cs_a: u16, cs_b: u16, len_b: usize) -> u16 {
+    let pow = pow_256_mod(len_b, MODULUS_16 as u64);
+    ((cs_a as u64 * pow + cs_b as u64) % MODULUS_16 as u64) as u16
+}
+
+/// Combine two independently computed Koopman32 checksums.
+///
+/// Produces the checksum of the concatenation A||B from the checksums of the
+/// two parts. The first part carries the overall seed; every subsequent part
+/// must be computed with seed 0.
+///
+/// # Arguments
+/// * `cs_a` - Checksum of the first part (computed with the overall seed)
+/// * `cs_b` - Checksum of the second part (computed with seed 0)
+/// * `len_b` - Length of the second part in bytes
+///
+/// # Returns
+/// The checksum of the concatenated data
+///
+/// # Example
+/// ```rust
+/// use koopman_checksum::{koopman32, koopman32_combine};
+///
+/// let (a, b) = (b"part ".as_slice(), b"two".as_slice());
+/// let combined = koopman32_combine(koopman32(a, 0xee), koopman32(b, 0), b.len());
+/// assert_eq!(combined, koopman32(&[a, b].concat(), 0xee));
+/// ```
+#[must_use]
+pub fn koopman32_combine(cs_a: u32, cs_b: u32, len_b: usize) -> u32 {
+    let pow = pow_256_mod(len_b, MODULUS_32);
+    (((cs_a as u128 * pow as u128 + cs_b as u128) % MODULUS_32 as u128) as u64) as u32
+}
+
+/// Combine two independently computed Koopman8P checksums (with parity).
+///
+/// The 7-bit checksum portions combine as in [`koopman8_combine`]; the parity
+/// bits XOR together.
+///
+/// # Arguments
+/// * `cs_a` - Checksum of the first part (computed with the overall seed)
+/// * `cs_b` - Checksum of the second part (computed with seed 0)
+/// * `len_b` - Length of the second part in bytes
+///
+/// # Returns
+/// The checksum-with-parity of the concatenated data
+///
+/// # Example
+/// ```rust
+/// use koopman_checksum::{koopman8p, koopman8p_combine};
+///
+/// let (a, b) = (b"ab".as_slice(), b"cd".as_slice());
+/// let combined = koopman8p_combine(koopman8p(a, 0xee), koopman8p(b, 0), b.len());
+/// assert_eq!(combined, koopman8p(&[a, b].concat(), 0xee));
+/// ```
+#[must_use]
+pub fn koopman8p_combine(cs_a: u8, cs_b: u8, len_b: usize) -> u8 {
+    let pow = pow_256_mod(len_b, MODULUS_7P as u64) as u32;
+    let sum = ((cs_a >> 1) as u32 * pow + (cs_b >> 1) as u32) % MODULUS_7P;
+    ((sum as u8) << 1) | ((cs_a ^ cs_b) & 1)
+}
+
+/// Combine two independently computed Koopman16P checksums (with parity).
+///
+/// The 15-bit checksum portions combine as in [`koopman16_combine`]; the
+/// parity bits XOR together.
+///
+/// # Arguments
+/// * `cs_a` - Checksum of the first part (computed with the overall seed)
+/// * `cs_b` - Checksum of the second part (computed with seed 0)
+/// * `len_b` - Length of the second part in bytes
+///
+/// # Returns
+/// The checksum-with-parity of the concatenated data
+///
+/// # Example
+/// ```rust
+/// use koopman_checksum::{koopman16p, koopman16p_combine};
+///
+/// let (a, b) = (b"part ".as_slice(), b"two".as_slice());
+/// let combined = koopman16p_combine(koopman16p(a, 0xee), koopman16p(b, 0), b.len());
+/// assert_eq!(combined, koopman16p(&[a, b].concat(), 0xee));
+/// ```
+#[must_use]
+pub fn koopman16p_combine(cs_a: u16, cs_b: u16, len_b: usize) -> u16 {
+    let pow = pow_256_mod(len_b, MODULUS_15P as u64);
+    let sum = ((cs_a >> 1) as u64 * pow + (cs_b >> 1) as u64) % MODULUS_15P as u64;
+    ((sum as u16) << 1) | ((cs_a ^ cs_b) & 1)
+}
+
+/// Combine two independently computed Koopman32P checksums (with parity).
+///
+/// The 31-bit checksum portions combine as in [`koopman32_combine`]; the
+/// parity bits XOR together.
+///
+/// # Arguments
+/// * `cs_a` - Checksum of the first part (computed with the overall seed)
+/// * `cs_b` - Checksum of the second part (computed with seed 0)
+/// * `len_b` - Length of the second part in bytes
+///
+/// # Returns
+/// The checksum-with-parity of the concatenated data
+///
+/// # Example
+/// ```rust
+/// use koopman_checksum::{koopman32p, koopman32p_combine};
+///
+/// let (a, b) = (b"part ".as_slice(), b"two".as_slice());
+/// let combined = koopman32p_combine(koopman32p(a, 0xee), koopman32p(b, 0), b.len());
+/// assert_eq!(combined, koopman32p(&[a, b].concat(), 0xee));
+/// ```
+#[must_use]
+pub fn koopman32p_combine(cs_a: u32, cs_b: u32, len_b: usize) -> u32 {
+    let pow = pow_256_mod(len_b, MODULUS_31P);
+    let sum = ((cs_a >> 1) as u128 * pow as u128 + (cs_b >> 1) as u128) % MODULUS_31P as u128;
+    ((sum as u32) << 1) | ((cs_a ^ cs_b) & 1)
+}
+
+/// Recompute a Koopman32 checksum after an in-place byte-range edit.
+///
+/// The checksum is a weighted modular sum, so replacing the bytes at
+/// `offset..offset + old_bytes.len()` shifts it by
+/// `Σ (new[i] - old[i]) * 256^(total_len + 3 - offset - i) mod m` — the
+/// rest of the buffer never needs to be touched. Cost is
+/// O(edit size + log total_len) instead of O(total_len).
+///
+/// # Arguments
+/// * `old_checksum` - Checksum of the buffer before the edit
+/// * `total_len` - Total buffer length in bytes (unchanged by the edit)
+/// * `offset` - Byte offset of the edited range
+/// * `old_bytes` - The bytes previously at the edited range
+/// * `new_bytes` - The bytes now at the edited range (same length)
+/// * `initial_seed` - Seed used when computing the checksum
+///
+/// # Returns
+/// The checksum of the edited buffer
+///
+/// # Panics
+/// Panics if `old_bytes` and `new_bytes` differ in length or the edited
+/// range extends past `total_len`.
+///
+/// # Example
+/// ```rust
+/// use koopman_checksum::{koopman32, koopman32_update_range};
+///
+/// let mut data = *b"some cached page contents";
+/// let before = koopman32(&data, 0xee);
+/// data[5..11].copy_from_slice(b"edited");
+/// let patched = koopman32_update_range(before, data.len(), 5, b"cached", b"edited", 0xee);
+/// assert_eq!(patched, koopman32(&data, 0xee));
+/// ```
+#[must_use]
+pub fn koopman32_update_range(
+    old_checksum: u32,
+    total_len: usize,
+    offset: usize,
+    old_bytes: &[u8],
+    new_bytes: &[u8],
+    initial_seed: u8,
+) -> u32 {
+    assert_eq!(
+        old_bytes.len(),
+        new_bytes.len(),
+        "old and new ranges must have the same length"
+    );
+    assert!(
+        offset + old_bytes.len() <= total_len,
+        "edited range extends past the buffer"
+    );
+
+    if old_bytes.is_empty() {
+        return old_checksum;
+    }
+
+    // Weight of the last edited byte in the finalized checksum: the byte at
+    // position p carries 256^(total_len - 1 - p) plus the four implicit
+    // zero bytes, i.e. 256^(total_len + 3 - p)
+    let last = offset + old_bytes.len() - 1;
+    let mut weight = pow_256_mod(total_len + 3 - last, MODULUS_32);
+
+    let mut sum = old_checksum as u64;
+    for i in (0..old_bytes.len()).rev() {
+        // The first data byte enters the sum XORed with the seed
+        let (old_b, new_b) = if offset + i == 0 {
+            (old_bytes[i] ^ initial_seed, new_bytes[i] ^ initial_seed)
+        } else {
+            (old_bytes[i], new_bytes[i])
+        };
+        let diff = (new_b as u64 + MODULUS_32 - old_b as u64) % MODULUS_32;
+        sum = (sum + ((weight as u128 * diff as u128) % MODULUS_32 as u128) as u64) % MODULUS_32;
+        weight = fast_mod_4294967291(weight << 8);
+    }
+
+    sum as u32
+}
+
+// ============================================================================
+// Parallel One-Shot API (requires the `parallel` feature)
+// ============================================================================
+
+/// Buffers smaller than this are checksummed sequentially by
+/// [`koopman32_parallel`]; thread spawn and combine overhead dominates below
+/// a few megabytes.
+#[cfg(feature = "parallel")]
+pub const PARALLEL_THRESHOLD: usize = 4 * 1024 * 1024;
+
+/// Compute a 32-bit Koopman checksum using multiple threads.
+///
+/// Splits buffers larger than [`PARALLEL_THRESHOLD`] across
+/// `std::thread::available_parallelism()` threads, checksums the chunks
+/// independently, and merges the partial results with [`koopman32_combine`].
+/// Produces bit-identical results to [`koopman32`]. Smaller buffers fall
+/// through to the sequential implementation.
+///
+/// # Arguments
+/// * `data` - The data bytes to checksum
+/// * `initial_seed` - Initial seed value
+///
+/// # Returns
+/// 32-bit checksum value, or 0 if data is empty
+///
+/// # Example
+/// ```rust
+/// use koopman_checksum::{koopman32, koopman32_parallel};
+///
+/// let data = vec![0xAB; 1024];
+/// assert_eq!(koopman32_parallel(&data, 0xee), koopman32(&data, 0xee));
+/// ```
+#[cfg(feature = "parallel")]
+#[must_use]
+pub fn koopman32_parallel(data: &[u8], initial_seed: u8) -> u32 {
+    if data.len() < PARALLEL_THRESHOLD {
+        return koopman32(data, initial_seed);
+    }
+
+    let threads = std::thread::available_parallelism()
+        .map(|n| n.get())
+        .unwrap_or(1);
+    let chunk_size = data.len().div_ceil(threads);
+    let chunks: Vec<&[u8]> = data.chunks(chunk_size).collect();
+
+    // The first chunk carries the seed; the rest use seed 0 so their
+    // checksums combine exactly (see koopman32_combine)
+    let parts: Vec<u32> = std::thread::scope(|s| {
+        let handles: Vec<_> = chunks
+            .iter()
+            .enumerate()
+            .map(|(i, chunk)| {
+                let seed = if i == 0 { initial_seed } else { 0 };
+                s.spawn(move || koopman32(chunk, seed))
+            })
+            .collect();
+        handles.into_iter().map(|h| h.join().unwrap()).collect()
+    });
+
+    let mut acc = parts[0];
+    for (&part, chunk) in parts[1..].iter().zip(&chunks[1..]) {
+        acc = koopman32_combine(acc, part, chunk.len());
+    }
+    acc
+}
+
+// ============================================================================
+// Chunked Tree Checksum (requires the `std` feature)
+//
+// Leaf checksums over fixed-size chunks let a random read out of a large
+// object be verified against a single leaf instead of re-checksumming
+// the whole object. Because of the combination identity the leaves also
+// determine the whole-object checksum, so the root comes for free and
+// always matches `koopman32` over the full data. The index serializes to
+// a compact, versioned byte format for persisting next to the object.
+// ============================================================================
+
+/// Serialized [`KoopmanTree32`] index header: magic, format version.
+#[cfg(feature = "std")]
+const TREE32_MAGIC: [u8; 4] = *b"KT32";
+#[cfg(feature = "std")]
+const TREE32_VERSION: u8 = 1;
+
+/// A chunked checksum index over a large object.
+///
+/// Built once over the whole object, it verifies any aligned chunk-sized
+/// read independently — the dominant access pattern for large objects
+/// read at random offsets. All leaves are computed with seed 0 so they
+/// combine; [`root`](Self::root) equals `koopman32(data, 0)`.
+///
+/// # Example
+/// ```rust
+/// use koopman_checksum::{koopman32, KoopmanTree32};
+///
+/// let object: Vec<u8> = (0..200_000).map(|i| (i % 251) as u8).collect();
+/// let tree = KoopmanTree32::build(&object, 65536);
+///
+/// // Verify one 64 KB read without touching the rest of the object
+/// assert!(tree.verify_chunk(1, &object[65536..131072]));
+/// assert_eq!(tree.root(), koopman32(&object, 0));
+///
+/// // Persist the index next to the object and load it back
+/// let bytes = tree.to_bytes();
+/// assert_eq!(KoopmanTree32::from_bytes(&bytes), Some(tree));
+/// ```
+#[cfg(feature = "std")]
+#[derive(Clone, Debug, PartialEq, Eq)]
+pub struct KoopmanTree32 {
+    chunk_size: u32,
+    total_len: u64,
+    leaves: Vec<u32>,
+}
+
+#[cfg(feature = "std")]
+impl KoopmanTree32 {
+    /// Build the index over `data` with the given chunk size.
+    ///
+    /// The final chunk may be shorter than `chunk_size`. An empty object
+    /// produces an index with no leaves whose root is 0.
+    ///
+    /// # Panics
+    /// Panics if `chunk_size` is 0 or exceeds `u32::MAX`.
+    #[must_use]
+    pub fn build(data: &[u8], chunk_size: usize) -> Self {
+        Self::check_chunk_size(chunk_size);
+        Self {
+            chunk_size: chunk_size as u32,
+            total_len: data.len() as u64,
+            leaves: data.chunks(chunk_size).map(|c| koopman32(c, 0)).collect(),
+        }
+    }
+
+    /// Build the index with the leaves computed on multiple threads.
+    ///
+    /// Leaves are independent, so they split cleanly across
+    /// `std::thread::available_parallelism()` threads. Produces the same
+    /// index as [`build`](Self::build).
+    ///
+    /// # Panics
+    /// Panics if `chunk_size` is 0 or exceeds `u32::MAX`.
+    #[cfg(feature = "parallel")]
+    #[must_use]
+    pub fn build_parallel(data: &[u8], chunk_size: usize) -> Self {
+        Self::check_chunk_size(chunk_size);
+        let chunks: Vec<&[u8]> = data.chunks(chunk_size).collect();
+        let threads = std::thread::available_parallelism()
+            .map(|n| n.get())
+            .unwrap_or(1);
+        let per_thread = chunks.len().div_ceil(threads).max(1);
+
+        let leaves = std::thread::scope(|s| {
+            let handles: Vec<_> = chunks
+                .chunks(per_thread)
+                .map(|group| s.spawn(move || group.iter().map(|c| koopman32(c, 0)).collect()))
+                .collect();
+            let mut leaves: Vec<u32> = Vec::with_capacity(chunks.len());
+            for handle in handles {
+                let part: Vec<u32> = handle.join().unwrap();
+                leaves.extend(part);
+            }
+            leaves
+        });
+
+        Self {
+            chunk_size: chunk_size as u32,
+            total_len: data.len() as u64,
+            leaves,
+        }
+    }
+
+    fn check_chunk_size(chunk_size: usize) {
+        assert!(chunk_size > 0, "chunk size must be non-zero");
+        assert!(
+            u32::try_from(chunk_size).is_ok(),
+            "chunk size must fit in u32"
+        );
+    }
+
+    /// The chunk size the index was built with.
+    #[inline]
+    #[must_use]
+    pub fn chunk_size(&self) -> usize {
+        self.chunk_size as usize
+    }
+
+    /// The length of the indexed object in bytes.
+    #[inline]
+    #[must_use]
+    pub fn total_len(&self) -> u64 {
+        self.total_len
+    }
+
+    /// The number of leaf chunks.
+    #[inline]
+    #[must_use]
+    pub fn num_chunks(&self) -> usize {
+        self.leaves.len()
+    }
+
+    /// The checksum of chunk `index`, or `None` if out of range.
+    #[inline]
+    #[must_use]
+    pub fn leaf(&self, index: usize) -> Option<u32> {
+        self.leaves.get(index).copied()
+    }
+
+    /// The expected length in bytes of chunk `index`, or `None` if out of
+    /// range. Only the final chunk may be shorter than the chunk size.
+    #[must_use]
+    pub fn chunk_len(&self, index: usize) -> Option<usize> {
+        if index >= self.leaves.len() {
+            return None;
+        }
+        let start = index as u64 * self.chunk_size as u64;
+        Some((self.total_len - start).min(self.chunk_size as u64) as usize)
+    }
+
+    /// Check a chunk read back from the object against its leaf.
+    ///
+    /// Returns `true` only if `index` is in range, `chunk` has the
+    /// expected length for that position, and its checksum matches.
+    #[must_use]
+    pub fn verify_chunk(&self, index: usize, chunk: &[u8]) -> bool {
+        match (self.leaf(index), self.chunk_len(index)) {
+            (Some(leaf), Some(len)) => chunk.len() == len && koopman32(chunk, 0) == leaf,
+            _ => false,
+        }
+    }
+
+    /// The whole-object checksum, equal to `koopman32` over the full
+    /// data with seed 0. Derived from the leaves via the combination
+    /// identity; the object itself is not needed.
+    #[must_use]
+    pub fn root(&self) -> u32 {
+        let Some((&first, rest)) = self.leaves.split_first() else {
+            return 0;
+        };
+        let mut acc = first;
+        for (index, &leaf) in rest.iter().enumerate() {
+            // chunk_len is in range by construction
+            acc = koopman32_combine(acc, leaf, self.chunk_len(index + 1).unwrap());
+        }
+        acc
+    }
+
+    /// Serialize the index to its stable byte format: a 4-byte magic, a
+    /// version byte, the chunk size (u32), the object length (u64), and
+    /// one u32 per leaf, all big-endian.
+    #[must_use]
+    pub fn to_bytes(&self) -> Vec<u8> {
+        let mut out = Vec::with_capacity(17 + 4 * self.leaves.len());
+        out.extend_from_slice(&TREE32_MAGIC);
+        out.push(TREE32_VERSION);
+        out.extend_from_slice(&self.chunk_size.to_be_bytes());
+        out.extend_from_slice(&self.total_len.to_be_bytes());
+        for leaf in &self.leaves {
+            out.extend_from_slice(&leaf.to_be_bytes());
+        }
+        out
+    }
+
+    /// Deserialize an index previously produced by
+    /// [`to_bytes`](Self::to_bytes).
+    ///
+    /// # Returns
+    /// The index, or `None` if the bytes are not a well-formed version-1
+    /// index (bad magic, zero chunk size, or a leaf count inconsistent
+    /// with the recorded object length)
+    #[must_use]
+    pub fn from_bytes(bytes: &[u8]) -> Option<Self> {
+        if bytes.len() < 17 || bytes[..4] != TREE32_MAGIC || bytes[4] != TREE32_VERSION {
+            return None;
+        }
+        let chunk_size = u32::from_be_bytes(bytes[5..9].try_into().unwrap());
+        let total_len = u64::from_be_bytes(bytes[9..17].try_into().unwrap());
+        if chunk_size == 0 {
+            return None;
+        }
+
+        let expected_leaves = total_len.div_ceil(chunk_size as u64);
+        let body = &bytes[17..];
+        // Checked: a hostile total_len/chunk_size pair can overflow the
+        // multiply, and a wrapped product must not validate the body
+        let expected_body_len = expected_leaves.checked_mul(4)?;
+        if body.len() as u64 != expected_body_len {
+            return None;
+        }
+
+        let leaves = body
+            .chunks_exact(4)
+            .map(|c| u32::from_be_bytes(c.try_into().unwrap()))
+            .collect();
+        Some(Self {
+            chunk_size,
+            total_len,
+            leaves,
+        })
+    }
+}
+
+// ============================================================================
+// Streaming/Incremental API
+// ============================================================================
+
+/// Macro to generate streaming checksum structs.
+/// This reduces code duplication across Koopman8, Koopman16, Koopman32.
+macro_rules! impl_streaming_hasher {
+    (
+        $name:ident,
+        $sum_type:ty,
+        $output_type:ty,
+        $default_modulus_raw:expr,
+        $nonzero_type:ty,
+        $finalize_shifts:expr,
+        $finalize_factor:expr,
+        $fast_mod:expr,
+        $barrett_rcp:expr,
+        $barrett_mod:expr
+    ) => {
+        impl Default for $name {
+            fn default() -> Self {
+                Self::new()
+            }
+        }
+
+        impl $name {
+            /// Create a new hasher with the default modulus.
+            #[inline]
+            pub fn new() -> Self {
+                Self {
+                    sum: 0,
+                    modulus: $default_modulus_raw,
+                    rcp: $barrett_rcp($default_modulus_raw),
+                    seed: 0,
+                    initialized: false,
+                    use_fast_mod: true,
+                    #[cfg(feature = "telemetry")]
+                    stats: crate::telemetry::HasherStats::default(),
+                }
+            }
+
+            /// Create a new hasher with a custom modulus.
+            ///
+            /// # Arguments
+            /// * `modulus` - The modulus to use. Must be non-zero.
+            ///
+            /// # Example
+            /// ```rust
+            #[doc = concat!("use std::num::", stringify!($nonzero_type), ";")]
+            #[doc = concat!("use koopman_checksum::{", stringify!($name), ", ", stringify!($default_modulus_raw), "};")]
+            ///
+            #[doc = concat!("let modulus = ", stringify!($nonzero_type), "::new(", stringify!($default_modulus_raw), ").unwrap();")]
+            #[doc = concat!("let hasher = ", stringify!($name), "::with_modulus(modulus);")]
+            /// ```
+            #[inline]
+            pub fn with_modulus(modulus: $nonzero_type) -> Self {
+                let modulus_val = modulus.get();
+                Self {
+                    sum: 0,
+                    modulus: modulus_val,
+                    rcp: $barrett_rcp(modulus_val),
+                    seed: 0,
+                    initialized: false,
+                    use_fast_mod: modulus_val == $default_modulus_raw,
+                    #[cfg(feature = "telemetry")]
+                    stats: crate::telemetry::HasherStats::default(),
+                }
+            }
+
+            /// Create a new hasher with an initial seed.
+            ///
+            /// # Example
+            /// ```rust
+            #[doc = concat!("use koopman_checksum::", stringify!($name), ";")]
+            ///
+            #[doc = concat!("let hasher = ", stringify!($name), "::with_seed(0xee);")]
+            /// ```
+            #[inline]
+            pub fn with_seed(seed: u8) -> Self {
+                Self {
+                    sum: seed as $sum_type,
+                    modulus: $default_modulus_raw,
+                    rcp: $barrett_rcp($default_modulus_raw),
+                    seed: seed as $sum_type,
+                    initialized: false,
+                    use_fast_mod: true,
+                    #[cfg(feature = "telemetry")]
+                    stats: crate::telemetry::HasherStats::default(),
+                }
+            }
+
+            /// Cold prologue for the first byte ever fed: fold it into the
+            /// seed and return the remainder. Out of line so the
+            /// steady-state update loop is a branch-free slice walk.
+            #[cold]
+            fn init_first_byte<'a>(&mut self, data: &'a [u8]) -> &'a [u8] {
+                self.sum ^= data[0] as $sum_type;
+                self.initialized = true;
+                &data[1..]
+            }
+
+            /// Update the checksum with more data.
+            #[inline]
+            pub fn update(&mut self, data: &[u8]) {
+                if data.is_empty() {
+                    return;
+                }
+
+                // Once per call, not per byte: the counters stay off the
+                // byte loop's dependency chain
+                #[cfg(feature = "telemetry")]
+                {
+                    self.stats.update_calls += 1;
+                    self.stats.bytes += data.len() as u64;
+                    crate::telemetry::record_update(data.len(), self.use_fast_mod);
+                }
+
+                let body = if self.initialized {
+                    data
+                } else {
+                    self.init_first_byte(data)
+                };
+
+                if self.use_fast_mod {
+                    for &byte in body {
+                        self.sum = $fast_mod((self.sum << 8) + byte as $sum_type);
+                    }
+                } else {
+                    for &byte in body {
+                        self.sum =
+                            $barrett_mod((self.sum << 8) + byte as $sum_type, self.modulus, self.rcp);
+                    }
+                }
+            }
+
+            /// Update the checksum as if `n` zero bytes had been provided.
+            ///
+            /// A run of n zero bytes scales the Horner sum by 256^n mod m,
+            /// so the run collapses to one modular exponentiation and one
+            /// multiply — O(log n) instead of O(n). Produces the same state
+            /// as feeding n literal zero bytes to
+            #[doc = concat!("[`update`](", stringify!($name), "::update). Useful for sparse")]
+            /// data where long zero runs are known without materializing
+            /// them.
+            #[inline]
+            pub fn update_zeros(&mut self, mut n: usize) {
+                if n == 0 {
+                    return;
+                }
+                if !self.initialized {
+                    // The first byte is XORed with the seed, and a zero
+                    // byte leaves the seed unchanged
+                    self.initialized = true;
+                    n -= 1;
+                }
+                let factor = pow_256_mod(n, self.modulus as u64);
+                self.sum =
+                    ((self.sum as u128 * factor as u128) % self.modulus as u128) as $sum_type;
+            }
+
+            /// Finalize and return the checksum.
+            ///
+            /// Returns 0 if no data was provided.
+            #[inline]
+            #[must_use]
+            pub fn finalize(self) -> $output_type {
+                if !self.initialized {
+                    return 0;
+                }
+                let mut sum = self.sum;
+                if self.use_fast_mod {
+                    // The implicit zero bytes scale the sum by a
+                    // compile-time constant: 256^shifts mod m
+                    sum = $fast_mod(sum * $finalize_factor);
+                } else {
+                    // For an arbitrary modulus the per-step Barrett
+                    // reduction is cheaper than a generic exponentiation
+                    for _ in 0..$finalize_shifts {
+                        sum = $barrett_mod(sum << 8, self.modulus, self.rcp);
+                    }
+                }
+                sum as $output_type
+            }
+
+            /// Reset the hasher to initial state.
+            #[inline]
+            pub fn reset(&mut self) {
+                self.sum = self.seed;
+                self.initialized = false;
+            }
+
+            /// Per-hasher telemetry counters (the `telemetry` feature).
+            ///
+            /// Counts `update` calls and bytes fed to this hasher alone;
+            /// process-wide totals live in [`crate::telemetry`]. Not
+            /// cleared by [`reset`](Self::reset) and not part of
+            #[doc = concat!("[`state`](", stringify!($name), "::state).")]
+            #[cfg(feature = "telemetry")]
+            #[must_use]
+            pub fn stats(&self) -> crate::telemetry::HasherStats {
+                self.stats
+            }
+
+            /// Capture the hasher's state for checkpointing.
+            ///
+            /// Together with
+            #[doc = concat!("[`from_state`](", stringify!($name), "::from_state), lets a")]
+            /// long-running stream resume after a crash without re-hashing
+            /// the bytes already consumed: persist these few bytes
+            /// alongside the resume offset. The layout is fixed
+            /// (big-endian) and stable across processes.
+            ///
+            /// # Example
+            /// ```rust
+            #[doc = concat!("use koopman_checksum::", stringify!($name), ";")]
+            ///
+            #[doc = concat!("let mut hasher = ", stringify!($name), "::new();")]
+            /// hasher.update(b"Hello, ");
+            /// let saved = hasher.state();
+            ///
+            #[doc = concat!("let mut resumed = ", stringify!($name), "::from_state(&saved).unwrap();")]
+            /// resumed.update(b"World!");
+            /// hasher.update(b"World!");
+            /// assert_eq!(resumed.finalize(), hasher.finalize());
+            /// ```
+            #[must_use]
+            pub fn state(&self) -> [u8; Self::STATE_SIZE] {
+                const W: usize = core::mem::size_of::<$sum_type>();
+                let mut out = [0u8; Self::STATE_SIZE];
+                out[..W].copy_from_slice(&self.sum.to_be_bytes());
+                out[W..2 * W].copy_from_slice(&self.modulus.to_be_bytes());
+                out[2 * W] = self.seed as u8;
+                out[2 * W + 1] = self.initialized as u8;
+                out
+            }
+
+            /// Reconstruct a hasher from bytes captured by
+            #[doc = concat!("[`state`](", stringify!($name), "::state).")]
+            ///
+            /// The Barrett reciprocal and fast-path flag are derived from
+            /// the stored modulus, so only the irreducible state is
+            /// persisted.
+            ///
+            /// # Returns
+            /// The hasher, or `None` if the bytes are not a valid state
+            /// (zero modulus or an out-of-range flag byte)
+            #[must_use]
+            pub fn from_state(state: &[u8; Self::STATE_SIZE]) -> Option<Self> {
+                const W: usize = core::mem::size_of::<$sum_type>();
+                let modulus = <$sum_type>::from_be_bytes(state[W..2 * W].try_into().unwrap());
+                if modulus == 0 || state[2 * W + 1] > 1 {
+                    return None;
+                }
+                Some(Self {
+                    sum: <$sum_type>::from_be_bytes(state[..W].try_into().unwrap()),
+                    modulus,
+                    rcp: $barrett_rcp(modulus),
+                    seed: state[2 * W] as $sum_type,
+                    initialized: state[2 * W + 1] == 1,
+                    use_fast_mod: modulus == $default_modulus_raw,
+                    #[cfg(feature = "telemetry")]
+                    stats: crate::telemetry::HasherStats::default(),
+                })
+            }
+        }
+
+        impl $name {
+            /// Size in bytes of the serialized state returned by
+            #[doc = concat!("[`state`](", stringify!($name), "::state):")]
+            /// sum, modulus, seed byte, initialized flag.
+            pub const STATE_SIZE: usize = 2 * core::mem::size_of::<$sum_type>() + 2;
+        }
+    };
+}
+
+/// Incremental Koopman8 checksum calculator.
+///
+/// Allows computing checksums over data that arrives in chunks.
+///
+/// # Example
+/// ```rust
+/// use koopman_checksum::Koopman8;
+///
+/// let mut hasher = Koopman8::new();
+/// hasher.update(b"Hello, ");
+/// hasher.update(b"World!");
+/// let checksum = hasher.finalize();
+/// ```
+#[derive(Clone, Debug)]
+pub struct Koopman8 {
+    sum: u32,
+    modulus: u32,
+    rcp: u32,
+    seed: u32,
+    initialized: bool,
+    use_fast_mod: bool,
+    #[cfg(feature = "telemetry")]
+    stats: crate::telemetry::HasherStats,
+}
+
+impl_streaming_hasher!(
+    Koopman8, u32, u8,
+    MODULUS_8, NonZeroU32,
+    1, 3, table_mod_8,
+    barrett_rcp_u32, barrett_mod_u32
+);
+
+/// Incremental Koopman16 checksum calculator.
+///
+/// Allows computing checksums over data that arrives in chunks.
+/// Uses fast modular reduction when using the default modulus.
+///
+/// # Example
+/// ```rust
+/// use koopman_checksum::Koopman16;
+///
+/// let mut hasher = Koopman16::new();
+/// hasher.update(b"Hello, ");
+/// hasher.update(b"World!");
+/// let checksum = hasher.finalize();
+/// ```
+#[derive(Clone, Debug)]
+pub struct Koopman16 {
+    sum: u32,
+    modulus: u32,
+    rcp: u32,
+    seed: u32,
+    initialized: bool,
+    use_fast_mod: bool,
+    #[cfg(feature = "telemetry")]
+    stats: crate::telemetry::HasherStats,
+}
+
+impl_streaming_hasher!(
+    Koopman16, u32, u16,
+    MODULUS_16, NonZeroU32,
+    2, 17, fast_mod_65519,
+    barrett_rcp_u32, barrett_mod_u32
+);
+
+/// Incremental Koopman32 checksum calculator.
+///
+/// Allows computing checksums over data that arrives in chunks.
+/// Uses fast modular reduction when using the default modulus.
+///
+/// # Example
+/// ```rust
+/// use koopman_checksum::Koopman32;
+///
+/// let mut hasher = Koopman32::new();
+/// hasher.update(b"Hello, ");
+/// hasher.update(b"World!");
+/// let checksum = hasher.finalize();
+/// ```
+#[derive(Clone, Debug)]
+pub struct Koopman32 {
+    sum: u64,
+    modulus: u64,
+    rcp: u64,
+    seed: u64,
+    initialized: bool,
+    use_fast_mod: bool,
+    #[cfg(feature = "telemetry")]
+    stats: crate::telemetry::HasherStats,
+}
+
+impl_streaming_hasher!(
+    Koopman32, u64, u32,
+    MODULUS_32, NonZeroU64,
+    4, 5, fast_mod_4294967291,
+    barrett_rcp_u64, barrett_mod_u64
+);
+
+// ============================================================================
+// Parity Streaming API
+// ============================================================================
+
+/// Macro to generate streaming parity checksum structs.
+macro_rules! impl_streaming_parity_hasher {
+    (
+        $name:ident,
+        $sum_type:ty,
+        $output_type:ty,
+        $default_modulus_raw:expr,
+        $nonzero_type:ty,
+        $finalize_shifts:expr,
+        $finalize_factor:expr,
+        $fast_mod:expr,
+        $barrett_rcp:expr,
+        $barrett_mod:expr
+    ) => {
+        impl Default for $name {
+            fn default() -> Self {
+                Self::new()
+            }
+        }
+
+        impl $name {
+            /// Create a new hasher with the default modulus.
+            #[inline]
+            pub fn new() -> Self {
+                Self {
+                    sum: 0,
+                    psum: 0,
+                    modulus: $default_modulus_raw,
+                    rcp: $barrett_rcp($default_modulus_raw),
+                    seed: 0,
+                    initialized: false,
+                    use_fast_mod: true,
+                    #[cfg(feature = "telemetry")]
+                    stats: crate::telemetry::HasherStats::default(),
+                }
+            }
+
+            /// Create a new hasher with a custom modulus.
+            ///
+            /// # Arguments
+            /// * `modulus` - The modulus to use. Must be non-zero.
+            #[inline]
+            pub fn with_modulus(modulus: $nonzero_type) -> Self {
+                let modulus_val = modulus.get();
+                Self {
+                    sum: 0,
+                    psum: 0,
+                    modulus: modulus_val,
+                    rcp: $barrett_rcp(modulus_val),
+                    seed: 0,
+                    initialized: false,
+                    use_fast_mod: modulus_val == $default_modulus_raw,
+                    #[cfg(feature = "telemetry")]
+                    stats: crate::telemetry::HasherStats::default(),
+                }
+            }
+
+            /// Create a new hasher with an initial seed.
+            #[inline]
+            pub fn with_seed(seed: u8) -> Self {
+                Self {
+                    sum: seed as $sum_type,
+                    psum: seed,
+                    modulus: $default_modulus_raw,
+                    rcp: $barrett_rcp($default_modulus_raw),
+                    seed: seed as $sum_type,
+                    initialized: false,
+                    use_fast_mod: true,
+                    #[cfg(feature = "telemetry")]
+                    stats: crate::telemetry::HasherStats::default(),
+                }
+            }
+
+            /// Cold prologue for the first byte ever fed: fold it into the
+            /// seed (checksum and parity) and return the remainder. Out of
+            /// line so the steady-state update loop is a branch-free slice
+            /// walk.
+            #[cold]
+            fn init_first_byte<'a>(&mut self, data: &'a [u8]) -> &'a [u8] {
+                self.sum ^= data[0] as $sum_type;
+                self.psum ^= data[0];
+                self.initialized = true;
+                &data[1..]
+            }
+
+            /// Update the checksum with more data.
+            #[inline]
+            pub fn update(&mut self, data: &[u8]) {
+                if data.is_empty() {
+                    return;
+                }
+
+                // Once per call, not per byte: the counters stay off the
+                // byte loop's dependency chain
+                #[cfg(feature = "telemetry")]
+                {
+                    self.stats.update_calls += 1;
+                    self.stats.bytes += data.len() as u64;
+                    crate::telemetry::record_update(data.len(), self.use_fast_mod);
+                }
+
+                let body = if self.initialized {
+                    data
+                } else {
+                    self.init_first_byte(data)
+                };
+
+                if self.use_fast_mod {
+                    for &byte in body {
+                        self.sum = $fast_mod((self.sum << 8) + byte as $sum_type);
+                    }
+                } else {
+                    for &byte in body {
+                        self.sum = $barrett_mod(
+                            (self.sum << 8) + byte as $sum_type,
+                            self.modulus,
+                            self.rcp,
+                        );
+                    }
+                }
+
+                // Parity takes its own wide pass instead of riding the
+                // modular loop's dependency chain
+                self.psum ^= xor_fold(body);
+            }
+
+            /// Update the checksum as if `n` zero bytes had been provided.
+            ///
+            /// A run of n zero bytes scales the Horner sum by 256^n mod m
+            /// and contributes nothing to the parity byte, so the run
+            /// collapses to one modular exponentiation and one multiply —
+            /// O(log n) instead of O(n). Produces the same state as feeding
+            /// n literal zero bytes to
+            #[doc = concat!("[`update`](", stringify!($name), "::update).")]
+            #[inline]
+            pub fn update_zeros(&mut self, mut n: usize) {
+                if n == 0 {
+                    return;
+                }
+                if !self.initialized {
+                    // The first byte is XORed with the seed, and a zero
+                    // byte leaves the seed (and its parity) unchanged
+                    self.initialized = true;
+                    n -= 1;
+                }
+                let factor = pow_256_mod(n, self.modulus as u64);
+                self.sum =
+                    ((self.sum as u128 * factor as u128) % self.modulus as u128) as $sum_type;
+            }
+
+            /// Finalize and return the checksum with parity.
+            ///
+            /// Returns 0 if no data was provided.
+            #[inline]
+            #[must_use]
+            pub fn finalize(self) -> $output_type {
+                if !self.initialized {
+                    return 0;
+                }
+                let mut sum = self.sum;
+                if self.use_fast_mod {
+                    // The implicit zero bytes scale the sum by a
+                    // compile-time constant: 256^shifts mod m
+                    sum = $fast_mod(sum * $finalize_factor);
+                } else {
+                    for _ in 0..$finalize_shifts {
+                        sum = $barrett_mod(sum << 8, self.modulus, self.rcp);
+                    }
+                }
+                // Pack: checksum in upper bits, parity in LSB
+                ((sum as $output_type) << 1) | (parity8(self.psum) as $output_type)
+            }
+
+            /// Reset the hasher to initial state.
+            #[inline]
+            pub fn reset(&mut self) {
+                self.sum = self.seed;
+                self.psum = self.seed as u8;
+                self.initialized = false;
+            }
+
+            /// Per-hasher telemetry counters (the `telemetry` feature).
+            ///
+            /// Counts `update` calls and bytes fed to this hasher alone;
+            /// process-wide totals live in [`crate::telemetry`]. Not
+            /// cleared by [`reset`](Self::reset) and not part of
+            #[doc = concat!("[`state`](", stringify!($name), "::state).")]
+            #[cfg(feature = "telemetry")]
+            #[must_use]
+            pub fn stats(&self) -> crate::telemetry::HasherStats {
+                self.stats
+            }
+
+            /// Capture the hasher's state for checkpointing.
+            ///
+            /// Together with
+            #[doc = concat!("[`from_state`](", stringify!($name), "::from_state), lets a")]
+            /// long-running stream resume after a crash without re-hashing
+            /// the bytes already consumed: persist these few bytes
+            /// alongside the resume offset. The layout is fixed
+            /// (big-endian) and stable across processes.
+            ///
+            /// # Example
+            /// ```rust
+            #[doc = concat!("use koopman_checksum::", stringify!($name), ";")]
+            ///
+            #[doc = concat!("let mut hasher = ", stringify!($name), "::new();")]
+            /// hasher.update(b"Hello, ");
+            /// let saved = hasher.state();
+            ///
+            #[doc = concat!("let mut resumed = ", stringify!($name), "::from_state(&saved).unwrap();")]
+            /// resumed.update(b"World!");
+            /// hasher.update(b"World!");
+            /// assert_eq!(resumed.finalize(), hasher.finalize());
+            /// ```
+            #[must_use]
+            pub fn state(&self) -> [u8; Self::STATE_SIZE] {
+                const W: usize = core::mem::size_of::<$sum_type>();
+                let mut out = [0u8; Self::STATE_SIZE];
+                out[..W].copy_from_slice(&self.sum.to_be_bytes());
+                out[W..2 * W].copy_from_slice(&self.modulus.to_be_bytes());
+                out[2 * W] = self.seed as u8;
+                out[2 * W + 1] = self.initialized as u8;
+                out[2 * W + 2] = self.psum;
+                out
+            }
+
+            /// Reconstruct a hasher from bytes captured by
+            #[doc = concat!("[`state`](", stringify!($name), "::state).")]
+            ///
+            /// The Barrett reciprocal and fast-path flag are derived from
+            /// the stored modulus, so only the irreducible state is
+            /// persisted.
+            ///
+            /// # Returns
+            /// The hasher, or `None` if the bytes are not a valid state
+            /// (zero modulus or an out-of-range flag byte)
+            #[must_use]
+            pub fn from_state(state: &[u8; Self::STATE_SIZE]) -> Option<Self> {
+                const W: usize = core::mem::size_of::<$sum_type>();
+                let modulus = <$sum_type>::from_be_bytes(state[W..2 * W].try_into().unwrap());
+                if modulus == 0 || state[2 * W + 1] > 1 {
+                    return None;
+                }
+                Some(Self {
+                    sum: <$sum_type>::from_be_bytes(state[..W].try_into().unwrap()),
+                    psum: state[2 * W + 2],
+                    modulus,
+                    rcp: $barrett_rcp(modulus),
+                    seed: state[2 * W] as $sum_type,
+                    initialized: state[2 * W + 1] == 1,
+                    use_fast_mod: modulus == $default_modulus_raw,
+                    #[cfg(feature = "telemetry")]
+                    stats: crate::telemetry::HasherStats::default(),
+                })
+            }
+        }
+
+        impl $name {
+            /// Size in bytes of the serialized state returned by
+            #[doc = concat!("[`state`](", stringify!($name), "::state):")]
+            /// sum, modulus, seed byte, initialized flag, parity byte.
+            pub const STATE_SIZE: usize = 2 * core::mem::size_of::<$sum_type>() + 3;
+        }
+    };
+}
+
+/// Incremental Koopman8P checksum calculator (7-bit checksum + 1 parity bit).
+///
+/// Allows computing checksums over data that arrives in chunks.
+///
+/// # Example
+/// ```rust
+/// use koopman_checksum::Koopman8P;
+///
+/// let mut hasher = Koopman8P::new();
+/// hasher.update(b"Hello");
+/// let checksum = hasher.finalize();
+/// let parity_bit = checksum & 1;
+/// ```
+#[derive(Clone, Debug)]
+pub struct Koopman8P {
+    sum: u32,
+    psum: u8,
+    modulus: u32,
+    rcp: u32,
+    seed: u32,
+    initialized: bool,
+    use_fast_mod: bool,
+    #[cfg(feature = "telemetry")]
+    stats: crate::telemetry::HasherStats,
+}
+
+impl_streaming_parity_hasher!(
+    Koopman8P, u32, u8,
+    MODULUS_7P, NonZeroU32,
+    1, 6, fast_mod_125,
+    barrett_rcp_u32, barrett_mod_u32
+);
+
+/// Incremental Koopman16P checksum calculator (15-bit checksum + 1 parity bit).
+///
+/// Allows computing checksums over data that arrives in chunks.
+///
+/// # Example
+/// ```rust
+/// use koopman_checksum::Koopman16P;
+///
+/// let mut hasher = Koopman16P::new();
+/// hasher.update(b"Hello, ");
+/// hasher.update(b"World!");
+/// let checksum = hasher.finalize();
+/// let parity_bit = checksum & 1;
+/// ```
+#[derive(Clone, Debug)]
+pub struct Koopman16P {
+    sum: u32,
+    psum: u8,
+    modulus: u32,
+    rcp: u32,
+    seed: u32,
+    initialized: bool,
+    use_fast_mod: bool,
+    #[cfg(feature = "telemetry")]
+    stats: crate::telemetry::HasherStats,
+}
+
+impl_streaming_parity_hasher!(
+    Koopman16P, u32, u16,
+    MODULUS_15P, NonZeroU32,
+    2, 38, fast_mod_32749,
+    barrett_rcp_u32, barrett_mod_u32
+);
+
+/// Incremental Koopman32P checksum calculator (31-bit checksum + 1 parity bit).
+///
+/// Allows computing checksums over data that arrives in chunks.
+///
+/// # Example
+/// ```rust
+/// use koopman_checksum::Koopman32P;
+///
+/// let mut hasher = Koopman32P::new();
+/// hasher.update(b"Hello, ");
+/// hasher.update(b"World!");
+/// let checksum = hasher.finalize();
+/// let parity_bit = checksum & 1;
+/// ```
+#[derive(Clone, Debug)]
+pub struct Koopman32P {
+    sum: u64,
+    psum: u8,
+    modulus: u64,
+    rcp: u64,
+    seed: u64,
+    initialized: bool,
+    use_fast_mod: bool,
+    #[cfg(feature = "telemetry")]
+    stats: crate::telemetry::HasherStats,
+}
+
+impl_streaming_parity_hasher!(
+    Koopman32P, u64, u32,
+    MODULUS_31P, NonZeroU64,
+    4, 38, fast_mod_2147483629,
+    barrett_rcp_u64, barrett_mod_u64
+);
+
+// ============================================================================
+// Trait Integrations
+//
+// The streaming hashers plug into generic code without adapters:
+// `core::hash::Hasher` always, and the RustCrypto `digest` traits behind
+// the `digest` feature. Both delegate straight to the inherent
+// update/finalize methods — no allocation, no intermediate buffering.
+// ============================================================================
+
+/// Implement `core::hash::Hasher` by delegating to the inherent methods.
+/// `finish` peeks at the finalized value without consuming the hasher, so
+/// it can be called repeatedly as more data arrives.
+macro_rules! impl_core_hasher {
+    ($name:ident) => {
+        impl core::hash::Hasher for $name {
+            #[inline]
+            fn finish(&self) -> u64 {
+                self.clone().finalize() as u64
+            }
+
+            #[inline]
+            fn write(&mut self, bytes: &[u8]) {
+                self.update(bytes);
+            }
+        }
+    };
+}
+
+impl_core_hasher!(Koopman8);
+impl_core_hasher!(Koopman16);
+impl_core_hasher!(Koopman32);
+impl_core_hasher!(Koopman64);
+impl_core_hasher!(Koopman8P);
+impl_core_hasher!(Koopman16P);
+impl_core_hasher!(Koopman32P);
+
+/// Implement the `digest` crate's hash traits. The blanket
+/// `digest::Digest` impl then applies, so the hashers drop into code
+/// that is generic over `Digest`. Output is the checksum's big-endian
+/// byte representation.
+#[cfg(feature = "digest")]
+macro_rules! impl_digest_traits {
+    ($name:ident, $output_size:ty) => {
+        impl digest::HashMarker for $name {}
+
+        impl digest::OutputSizeUser for $name {
+            type OutputSize = $output_size;
+        }
+
+        impl digest::Update for $name {
+            #[inline]
+            fn update(&mut self, data: &[u8]) {
+                $name::update(self, data);
+            }
+        }
+
+        impl digest::FixedOutput for $name {
+            #[inline]
+            fn finalize_into(self, out: &mut digest::Output<Self>) {
+                out.copy_from_slice(&self.finalize().to_be_bytes());
+            }
+        }
+
+        impl digest::FixedOutputReset for $name {
+            #[inline]
+            fn finalize_into_reset(&mut self, out: &mut digest::Output<Self>) {
+                out.copy_from_slice(&self.clone().finalize().to_be_bytes());
+                self.reset();
+            }
+        }
+
+        impl digest::Reset for $name {
+            #[inline]
+            fn reset(&mut self) {
+                $name::reset(self);
+            }
+        }
+    };
+}
+
+#[cfg(feature = "digest")]
+impl_digest_traits!(Koopman16, digest::consts::U2);
+#[cfg(feature = "digest")]
+impl_digest_traits!(Koopman32, digest::consts::U4);
+#[cfg(feature = "digest")]
+impl_digest_traits!(Koopman64, digest::consts::U8);
+
+// ============================================================================
+// I/O Tee Adapters
+//
+// Wrappers that fuse checksumming into an I/O pass that is already
+// touching the bytes, instead of traversing the buffer a second time
+// afterwards (which for buffers larger than the last-level cache is pure
+// memory bandwidth). The adapters are generic over any hasher
+// implementing `core::hash::Hasher`, so they pick up whatever kernel the
+// chosen hasher uses internally; the default is [`Koopman32`].
+// ============================================================================
+
+/// A writer that updates a checksum with every byte passed through.
+///
+/// Bytes are forwarded to the inner writer unchanged; only bytes the
+/// inner writer actually accepts are checksummed, so the checksum always
+/// matches what landed in the destination.
+///
+/// # Example
+/// ```rust
+/// use std::io::Write;
+/// use koopman_checksum::{koopman32, ChecksumWriter};
+///
+/// let mut writer = ChecksumWriter::new(Vec::new());
+/// writer.write_all(b"archive contents").unwrap();
+/// assert_eq!(writer.checksum(), koopman32(b"archive contents", 0) as u64);
+/// ```
+#[cfg(feature = "std")]
+#[derive(Clone, Debug)]
+pub struct ChecksumWriter<W, H = Koopman32> {
+    inner: W,
+    hasher: H,
+}
+
+#[cfg(feature = "std")]
+impl<W> ChecksumWriter<W> {
+    /// Wrap a writer, checksumming with a default [`Koopman32`]. Use
+    /// [`with_hasher`](Self::with_hasher) for other widths or seeds.
+    #[inline]
+    pub fn new(inner: W) -> Self {
+        Self {
+            inner,
+            hasher: Koopman32::new(),
+        }
+    }
+}
+
+#[cfg(feature = "std")]
+impl<W, H: core::hash::Hasher> ChecksumWriter<W, H> {
+    /// Wrap a writer, checksumming with the given hasher (e.g. one
+    /// created with a seed or a custom modulus).
+    #[inline]
+    pub fn with_hasher(inner: W, hasher: H) -> Self {
+        Self { inner, hasher }
+    }
+
+    /// The checksum of everything written so far.
+    #[inline]
+    pub fn checksum(&self) -> u64 {
+        self.hasher.finish()
+    }
+
+    /// Get a reference to the inner writer.
+    #[inline]
+    pub fn get_ref(&self) -> &W {
+        &self.inner
+    }
+
+    /// Consume the adapter, returning the inner writer and the hasher.
+    #[inline]
+    pub fn into_parts(self) -> (W, H) {
+        (self.inner, self.hasher)
+    }
+}
+
+#[cfg(feature = "std")]
+impl<W: std::io::Write, H: core::hash::Hasher> std::io::Write for ChecksumWriter<W, H> {
+    #[inline]
+    fn write(&mut self, buf: &[u8]) -> std::io::Result<usize> {
+        let written = self.inner.write(buf)?;
+        self.hasher.write(&buf[..written]);
+        Ok(written)
+    }
+
+    #[inline]
+    fn flush(&mut self) -> std::io::Result<()> {
+        self.inner.flush()
+    }
+}
+
+/// A reader that updates a checksum with every byte passed through.
+///
+/// Bytes are forwarded from the inner reader unchanged; only bytes
+/// actually produced by a read are checksummed.
+///
+/// # Example
+/// ```rust
+/// use std::io::Read;
+/// use koopman_checksum::{koopman32, ChecksumReader};
+///
+/// let mut reader = ChecksumReader::new(&b"archive contents"[..]);
+/// let mut contents = Vec::new();
+/// reader.read_to_end(&mut contents).unwrap();
+/// assert_eq!(reader.checksum(), koopman32(&contents, 0) as u64);
+/// ```
+#[cfg(feature = "std")]
+#[derive(Clone, Debug)]
+pub struct ChecksumReader<R, H = Koopman32> {
+    inner: R,
+    hasher: H,
+}
+
+#[cfg(feature = "std")]
+impl<R> ChecksumReader<R> {
+    /// Wrap a reader, checksumming with a default [`Koopman32`]. Use
+    /// [`with_hasher`](Self::with_hasher) for other widths or seeds.
+    #[inline]
+    pub fn new(inner: R) -> Self {
+        Self {
+            inner,
+            hasher: Koopman32::new(),
+        }
+    }
+}
+
+#[cfg(feature = "std")]
+impl<R, H: core::hash::Hasher> ChecksumReader<R, H> {
+    /// Wrap a reader, checksumming with the given hasher (e.g. one
+    /// created with a seed or a custom modulus).
+    #[inline]
+    pub fn with_hasher(inner: R, hasher: H) -> Self {
+        Self { inner, hasher }
+    }
+
+    /// The checksum of everything read so far.
+    #[inline]
+    pub fn checksum(&self) -> u64 {
+        self.hasher.finish()
+    }
+
+    /// Get a reference to the inner reader.
+    #[inline]
+    pub fn get_ref(&self) -> &R {
+        &self.inner
+    }
+
+    /// Consume the adapter, returning the inner reader and the hasher.
+    #[inline]
+    pub fn into_parts(self) -> (R, H) {
+        (self.inner, self.hasher)
+    }
+}
+
+#[cfg(feature = "std")]
+impl<R: std::io::Read, H: core::hash::Hasher> std::io::Read for ChecksumReader<R, H> {
+    #[inline]
+    fn read(&mut self, buf: &mut [u8]) -> std::io::Result<usize> {
+        let read = self.inner.read(buf)?;
+        self.hasher.write(&buf[..read]);
+        Ok(read)
+    }
+}
+
+// ============================================================================
+// Self-Checksummed Frame Format
+//
+// Length-prefixed records with a trailing koopman16p (HD=4) checksum:
+//
+//   [payload length: u32 BE][payload][koopman16p of length + payload: u16 BE]
+//
+// The checksum covers the length prefix, so a corrupted length cannot
+// redirect the reader to valid-looking bytes elsewhere in the stream.
+// The writer folds the checksum into the write pass via ChecksumWriter;
+// the reader validates in place and yields payload slices borrowed from
+// the input buffer, so consuming a stream copies nothing.
+// ============================================================================
+
+/// Why a frame could not be read.
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+pub enum FrameError {
+    /// The buffer ends in the middle of a frame.
+    Truncated,
+    /// A frame's checksum does not match its contents.
+    ChecksumMismatch,
+}
+
+impl core::fmt::Display for FrameError {
+    fn fmt(&self, f: &mut core::fmt::Formatter<'_>) -> core::fmt::Result {
+        match self {
+            FrameError::Truncated => write!(f, "frame truncated"),
+            FrameError::ChecksumMismatch => write!(f, "frame checksum mismatch"),
+        }
+    }
+}
+
+#[cfg(feature = "std")]
+impl std::error::Error for FrameError {}
+
+/// A writer that emits self-checksummed, length-prefixed frames.
+///
+/// Each frame's [`koopman16p`] checksum (HD=4: detects all 1-, 2-, and
+/// 3-bit errors within the frame's coverage limit) is computed while the
+/// frame is written — no second pass over an assembled buffer.
+///
+/// # Example
+/// ```rust
+/// use koopman_checksum::{FrameReader, FrameWriter};
+///
+/// let mut writer = FrameWriter::new(Vec::new());
+/// writer.write_frame(b"record one").unwrap();
+/// writer.write_frame(b"record two").unwrap();
+///
+/// let stream = writer.into_inner();
+/// let records: Vec<&[u8]> = FrameReader::new(&stream)
+///     .collect::<Result<_, _>>()
+///     .unwrap();
+/// assert_eq!(records, [b"record one".as_slice(), b"record two".as_slice()]);
+/// ```
+#[cfg(feature = "std")]
+#[derive(Clone, Debug)]
+pub struct FrameWriter<W> {
+    inner: W,
+}
+
+#[cfg(feature = "std")]
+impl<W: std::io::Write> FrameWriter<W> {
+    /// Wrap a writer.
+    #[inline]
+    pub fn new(inner: W) -> Self {
+        Self { inner }
+    }
+
+    /// Write one frame.
+    ///
+    /// # Errors
+    /// Returns `InvalidInput` if the payload exceeds `u32::MAX` bytes;
+    /// otherwise propagates errors from the inner writer.
+    pub fn write_frame(&mut self, payload: &[u8]) -> std::io::Result<()> {
+        use std::io::Write;
+
+        let len = u32::try_from(payload.len()).map_err(|_| {
+            std::io::Error::new(std::io::ErrorKind::InvalidInput, "payload exceeds u32::MAX")
+        })?;
+
+        // The tee updates the checksum as the bytes go out
+        let mut tee = ChecksumWriter::with_hasher(&mut self.inner, Koopman16P::new());
+        tee.write_all(&len.to_be_bytes())?;
+        tee.write_all(payload)?;
+        let checksum = tee.checksum() as u16;
+
+        self.inner.write_all(&checksum.to_be_bytes())
+    }
+
+    /// Flush the inner writer.
+    #[inline]
+    pub fn flush(&mut self) -> std::io::Result<()> {
+        self.inner.flush()
+    }
+
+    /// Get a reference to the inner writer.
+    #[inline]
+    pub fn get_ref(&self) -> &W {
+        &self.inner
+    }
+
+    /// Consume the framer, returning the inner writer.
+    #[inline]
+    pub fn into_inner(self) -> W {
+        self.inner
+    }
+}
+
+/// A zero-copy reader over a buffer of self-checksummed frames.
+///
+/// Yields payload slices borrowed from the input buffer; payloads are
+/// never copied. Validation recomputes [`koopman16p`] over each frame's
+/// length prefix and payload in place. After the first error the reader
+/// is exhausted — a corrupted length prefix makes everything after it
+/// unreliable.
+///
+/// Available without `std`; only the writer needs `std::io`.
+#[derive(Clone, Debug)]
+pub struct FrameReader<'a> {
+    buf: &'a [u8],
+    pos: usize,
+}
+
+impl<'a> FrameReader<'a> {
+    /// Read frames from a buffer.
+    #[inline]
+    #[must_use]
+    pub fn new(buf: &'a [u8]) -> Self {
+        Self { buf, pos: 0 }
+    }
+
+    /// The byte offset of the next unread frame.
+    #[inline]
+    #[must_use]
+    pub fn position(&self) -> usize {
+        self.pos
+    }
+
+    /// Validate and return the next frame's payload, `Ok(None)` at the
+    /// end of the buffer.
+    pub fn next_frame(&mut self) -> Result<Option<&'a [u8]>, FrameError> {
+        let remaining = &self.buf[self.pos..];
+        if remaining.is_empty() {
+            return Ok(None);
+        }
+
+        let fail = |reader: &mut Self, err| {
+            // Nothing after a bad frame can be trusted: exhaust the reader
+            reader.pos = reader.buf.len();
+            Err(err)
+        };
+
+        if remaining.len() < 4 {
+            return fail(self, FrameError::Truncated);
+        }
+        let len = u32::from_be_bytes(remaining[..4].try_into().unwrap()) as usize;
+        let Some(total) = len.checked_add(6) else {
+            return fail(self, FrameError::Truncated);
+        };
+        if remaining.len() < total {
+            return fail(self, FrameError::Truncated);
+        }
+
+        // Length prefix and payload are contiguous: one in-place pass
+        let stored = u16::from_be_bytes(remaining[total - 2..total].try_into().unwrap());
+        if koopman16p(&remaining[..total - 2], 0) != stored {
+            return fail(self, FrameError::ChecksumMismatch);
+        }
+
+        self.pos += total;
+        Ok(Some(&remaining[4..total - 2]))
+    }
+}
+
+impl<'a> Iterator for FrameReader<'a> {
+    type Item = Result<&'a [u8], FrameError>;
+
+    fn next(&mut self) -> Option<Self::Item> {
+        self.next_frame().transpose()
+    }
+}
+
+// ============================================================================
+// Rolling-Window API
+//
+// Maintains the checksum of the last W bytes pushed. Because the Horner
+// form weights the oldest byte in the window by 256^(W-1) mod m, a full
+// window advances in O(1): subtract the outgoing byte's weighted
+// contribution, shift, and add the incoming byte. Useful for
+// content-defined chunking, where a rolling fingerprint and an integrity
+// checksum can share one scan over the buffer.
+//
+// The window is a const-generic parameter so the ring buffer lives inline
+// and the crate stays allocation-free. Rolling checksums use seed 0 and
+// match the one-shot functions over the current window contents.
+// ============================================================================
+
+/// Macro to generate rolling-window checksum structs.
+macro_rules! impl_rolling_hasher {
+    (
+        $name:ident,
+        $sum_type:ty,
+        $output_type:ty,
+        $modulus:expr,
+        $finalize_shifts:expr,
+        $fast_mod:expr
+    ) => {
+        impl<const W: usize> Default for $name<W> {
+            fn default() -> Self {
+                Self::new()
             }
+        }
 
-            /// Create a new hasher with a custom modulus.
-            ///
-            /// # Arguments
-            /// * `modulus` - The modulus to use. Must be non-zero.
-            ///
-            /// # Example
-            /// ```rust
-            #[doc = concat!("use std::num::", stringify!($nonzero_type), ";")]
-            #[doc = concat!("use koopman_checksum::{", stringify!($name), ", ", stringify!($default_modulus_raw), "};")]
-            ///
-            #[doc = concat!("let modulus = ", stringify!($nonzero_type), "::new(", stringify!($default_modulus_raw), ").unwrap();")]
-            #[doc = concat!("let hasher = ", stringify!($name), "::with_modulus(modulus);")]
-            /// ```
-            #[inline]
-            pub fn with_modulus(modulus: $nonzero_type) -> Self {
-                let modulus_val = modulus.get();
-                Self {
-                    sum: 0,
-                    modulus: modulus_val,
-                    seed: 0,
-                    initialized: false,
-                    use_fast_mod: modulus_val == $default_modulus_raw,
-                }
-            }
+        impl<const W: usize> $name<W> {
+            // Rejects W == 0 at compile time
+            const WINDOW_NONZERO: () = assert!(W != 0, "window must be non-zero");
 
-            /// Create a new hasher with an initial seed.
-            ///
-            /// # Example
-            /// ```rust
-            #[doc = concat!("use koopman_checksum::", stringify!($name), ";")]
-            ///
-            #[doc = concat!("let hasher = ", stringify!($name), "::with_seed(0xee);")]
-            /// ```
+            /// Create a new rolling hasher with an empty window.
             #[inline]
-            pub fn with_seed(seed: u8) -> Self {
+            pub fn new() -> Self {
+                let () = Self::WINDOW_NONZERO;
                 Self {
-                    sum: seed as $sum_type,
-                    modulus: $default_modulus_raw,
-                    seed: seed as $sum_type,
-                    initialized: false,
-                    use_fast_mod: true,
+                    sum: 0,
+                    // Weight of the window's oldest byte: 256^(W-1) mod m
+                    pow_out: pow_256_mod(W - 1, $modulus as u64) as $sum_type,
+                    buf: [0; W],
+                    pos: 0,
+                    len: 0,
                 }
             }
 
-            /// Update the checksum with more data.
+            /// Push a byte into the window, evicting the oldest byte once
+            /// the window is full.
             #[inline]
-            pub fn update(&mut self, data: &[u8]) {
-                if data.is_empty() {
+            pub fn push(&mut self, byte: u8) {
+                if self.len < W {
+                    self.sum = $fast_mod((self.sum << 8) + byte as $sum_type);
+                    self.buf[self.pos] = byte;
+                    self.pos = (self.pos + 1) % W;
+                    self.len += 1;
                     return;
                 }
 
-                let mut iter = data.iter();
-
-                if !self.initialized {
-                    if let Some(&first) = iter.next() {
-                        self.sum ^= first as $sum_type;
-                        self.initialized = true;
-                    }
-                }
-
-                if self.use_fast_mod {
-                    for &byte in iter {
-                        self.sum = $fast_mod((self.sum << 8) + byte as $sum_type);
-                    }
-                } else {
-                    for &byte in iter {
-                        self.sum = ((self.sum << 8) + byte as $sum_type) % self.modulus;
-                    }
+                // Remove the outgoing byte's contribution, then shift in the
+                // new byte. The intermediate sum + m - t stays below 2 * m.
+                let out = self.buf[self.pos];
+                let t = $fast_mod(out as $sum_type * self.pow_out);
+                let mut sum = self.sum + $modulus - t;
+                if sum >= $modulus {
+                    sum -= $modulus;
                 }
+                self.sum = $fast_mod((sum << 8) + byte as $sum_type);
+                self.buf[self.pos] = byte;
+                self.pos = (self.pos + 1) % W;
             }
 
-            /// Finalize and return the checksum.
+            /// Checksum of the current window contents.
             ///
-            /// Returns 0 if no data was provided.
+            /// Equal to the one-shot checksum (seed 0) of the last
+            /// `min(pushed, W)` bytes. Returns 0 if nothing has been pushed.
             #[inline]
             #[must_use]
-            pub fn finalize(self) -> $output_type {
-                if !self.initialized {
+            pub fn checksum(&self) -> $output_type {
+                if self.len == 0 {
                     return 0;
                 }
                 let mut sum = self.sum;
-                if self.use_fast_mod {
-                    for _ in 0..$finalize_shifts {
-                        sum = $fast_mod(sum << 8);
-                    }
-                } else {
-                    for _ in 0..$finalize_shifts {
-                        sum = (sum << 8) % self.modulus;
-                    }
+                for _ in 0..$finalize_shifts {
+                    sum = $fast_mod(sum << 8);
                 }
                 sum as $output_type
             }
 
-            /// Reset the hasher to initial state.
+            /// Number of bytes currently in the window.
+            #[inline]
+            #[must_use]
+            pub fn len(&self) -> usize {
+                self.len
+            }
+
+            /// Whether the window has seen at least W bytes.
+            #[inline]
+            #[must_use]
+            pub fn is_full(&self) -> bool {
+                self.len == W
+            }
+
+            /// Whether nothing has been pushed yet.
+            #[inline]
+            #[must_use]
+            pub fn is_empty(&self) -> bool {
+                self.len == 0
+            }
+
+            /// Reset to an empty window.
             #[inline]
             pub fn reset(&mut self) {
-                self.sum = self.seed;
-                self.initialized = false;
+                self.sum = 0;
+                self.pos = 0;
+                self.len = 0;
             }
         }
     };
 }
 
-/// Incremental Koopman8 checksum calculator.
-///
-/// Allows computing checksums over data that arrives in chunks.
-///
-/// # Example
-/// ```rust
-/// use koopman_checksum::Koopman8;
-///
-/// let mut hasher = Koopman8::new();
-/// hasher.update(b"Hello, ");
-/// hasher.update(b"World!");
-/// let checksum = hasher.finalize();
-/// ```
-#[derive(Clone, Debug)]
-pub struct Koopman8 {
-    sum: u32,
-    modulus: u32,
-    seed: u32,
-    initialized: bool,
-    use_fast_mod: bool,
-}
-
-// Koopman8 doesn't have a fast_mod, so we use a passthrough
-#[inline(always)]
-fn identity_mod_8(x: u32) -> u32 { x % MODULUS_8 }
-
-impl_streaming_hasher!(
-    Koopman8, u32, u8,
-    MODULUS_8, NonZeroU32,
-    1, identity_mod_8
-);
-
-/// Incremental Koopman16 checksum calculator.
-///
-/// Allows computing checksums over data that arrives in chunks.
-/// Uses fast modular reduction when using the default modulus.
+/// Rolling 16-bit Koopman checksum over a fixed-size window.
 ///
 /// # Example
 /// ```rust
-/// use koopman_checksum::Koopman16;
+/// use koopman_checksum::{koopman16, KoopmanRolling16};
 ///
-/// let mut hasher = Koopman16::new();
-/// hasher.update(b"Hello, ");
-/// hasher.update(b"World!");
-/// let checksum = hasher.finalize();
+/// let mut rolling = KoopmanRolling16::<4>::new();
+/// for &byte in b"abcdefgh" {
+///     rolling.push(byte);
+/// }
+/// assert_eq!(rolling.checksum(), koopman16(b"efgh", 0));
 /// ```
 #[derive(Clone, Debug)]
-pub struct Koopman16 {
+pub struct KoopmanRolling16<const W: usize> {
     sum: u32,
-    modulus: u32,
-    seed: u32,
-    initialized: bool,
-    use_fast_mod: bool,
+    pow_out: u32,
+    buf: [u8; W],
+    pos: usize,
+    len: usize,
 }
 
-impl_streaming_hasher!(
-    Koopman16, u32, u16,
-    MODULUS_16, NonZeroU32,
-    2, fast_mod_65519
+impl_rolling_hasher!(
+    KoopmanRolling16, u32, u16,
+    MODULUS_16, 2, fast_mod_65519
 );
 
-/// Incremental Koopman32 checksum calculator.
-///
-/// Allows computing checksums over data that arrives in chunks.
-/// Uses fast modular reduction when using the default modulus.
+/// Rolling 32-bit Koopman checksum over a fixed-size window.
 ///
 /// # Example
 /// ```rust
-/// use koopman_checksum::Koopman32;
+/// use koopman_checksum::{koopman32, KoopmanRolling32};
 ///
-/// let mut hasher = Koopman32::new();
-/// hasher.update(b"Hello, ");
-/// hasher.update(b"World!");
-/// let checksum = hasher.finalize();
+/// let mut rolling = KoopmanRolling32::<48>::new();
+/// let data = vec![0xAB; 100];
+/// for &byte in &data {
+///     rolling.push(byte);
+/// }
+/// assert_eq!(rolling.checksum(), koopman32(&data[100 - 48..], 0));
 /// ```
 #[derive(Clone, Debug)]
-pub struct Koopman32 {
+pub struct KoopmanRolling32<const W: usize> {
     sum: u64,
-    modulus: u64,
-    seed: u64,
-    initialized: bool,
-    use_fast_mod: bool,
+    pow_out: u64,
+    buf: [u8; W],
+    pos: usize,
+    len: usize,
 }
 
-impl_streaming_hasher!(
-    Koopman32, u64, u32,
-    MODULUS_32, NonZeroU64,
-    4, fast_mod_4294967291
+impl_rolling_hasher!(
+    KoopmanRolling32, u64, u32,
+    MODULUS_32, 4, fast_mod_4294967291
 );
 
 // ============================================================================
-// Parity Streaming API
+// Const-Generic Streaming API
+//
+// When the modulus is known at compile time, rustc strength-reduces the
+// division to a multiply-shift sequence on its own (including the 2^k - c
+// shortcut for moduli of that form), so these hashers carry no modulus, no
+// reciprocal, and no fast-path flag — just the accumulator, the seed, and
+// the initialization bit. Useful when exactly one modulus is compiled into
+// an image and many hashers are kept alive concurrently.
 // ============================================================================
 
-/// Macro to generate streaming parity checksum structs.
-macro_rules! impl_streaming_parity_hasher {
+/// Macro to generate const-generic streaming checksum structs.
+macro_rules! impl_fixed_hasher {
     (
         $name:ident,
         $sum_type:ty,
         $output_type:ty,
-        $default_modulus_raw:expr,
-        $nonzero_type:ty,
         $finalize_shifts:expr
     ) => {
-        impl Default for $name {
+        impl<const M: $sum_type> Default for $name<M> {
             fn default() -> Self {
                 Self::new()
             }
         }
 
-        impl $name {
-            /// Create a new hasher with the default modulus.
-            #[inline]
-            pub fn new() -> Self {
-                Self {
-                    sum: 0,
-                    psum: 0,
-                    modulus: $default_modulus_raw,
-                    seed: 0,
-                    initialized: false,
-                }
-            }
+        impl<const M: $sum_type> $name<M> {
+            // Rejects M == 0 at compile time
+            const MODULUS_NONZERO: () = assert!(M != 0, "modulus must be non-zero");
 
-            /// Create a new hasher with a custom modulus.
-            ///
-            /// # Arguments
-            /// * `modulus` - The modulus to use. Must be non-zero.
+            /// Create a new hasher.
             #[inline]
-            pub fn with_modulus(modulus: $nonzero_type) -> Self {
+            pub fn new() -> Self {
+                let () = Self::MODULUS_NONZERO;
                 Self {
                     sum: 0,
-                    psum: 0,
-                    modulus: modulus.get(),
                     seed: 0,
                     initialized: false,
                 }
@@ -809,10 +3652,9 @@ macro_rules! impl_streaming_parity_hasher {
             /// Create a new hasher with an initial seed.
             #[inline]
             pub fn with_seed(seed: u8) -> Self {
+                let () = Self::MODULUS_NONZERO;
                 Self {
                     sum: seed as $sum_type,
-                    psum: seed,
-                    modulus: $default_modulus_raw,
                     seed: seed as $sum_type,
                     initialized: false,
                 }
@@ -821,27 +3663,21 @@ macro_rules! impl_streaming_parity_hasher {
             /// Update the checksum with more data.
             #[inline]
             pub fn update(&mut self, data: &[u8]) {
-                if data.is_empty() {
-                    return;
-                }
-
                 let mut iter = data.iter();
 
                 if !self.initialized {
                     if let Some(&first) = iter.next() {
                         self.sum ^= first as $sum_type;
-                        self.psum ^= first;
                         self.initialized = true;
                     }
                 }
 
                 for &byte in iter {
-                    self.sum = ((self.sum << 8) + byte as $sum_type) % self.modulus;
-                    self.psum ^= byte;
+                    self.sum = ((self.sum << 8) + byte as $sum_type) % M;
                 }
             }
 
-            /// Finalize and return the checksum with parity.
+            /// Finalize and return the checksum.
             ///
             /// Returns 0 if no data was provided.
             #[inline]
@@ -852,108 +3688,86 @@ macro_rules! impl_streaming_parity_hasher {
                 }
                 let mut sum = self.sum;
                 for _ in 0..$finalize_shifts {
-                    sum = (sum << 8) % self.modulus;
+                    sum = (sum << 8) % M;
                 }
-                // Pack: checksum in upper bits, parity in LSB
-                ((sum as $output_type) << 1) | (parity8(self.psum) as $output_type)
+                sum as $output_type
             }
 
             /// Reset the hasher to initial state.
             #[inline]
             pub fn reset(&mut self) {
                 self.sum = self.seed;
-                self.psum = self.seed as u8;
                 self.initialized = false;
             }
         }
     };
 }
 
-/// Incremental Koopman8P checksum calculator (7-bit checksum + 1 parity bit).
+/// Incremental Koopman8 checksum calculator with a compile-time modulus.
 ///
-/// Allows computing checksums over data that arrives in chunks.
+/// Equivalent to [`Koopman8`] with the same modulus, but the reduction is
+/// constant-folded and the struct holds no runtime modulus state.
 ///
 /// # Example
 /// ```rust
-/// use koopman_checksum::Koopman8P;
+/// use koopman_checksum::{koopman8, Koopman8Fixed, MODULUS_8};
 ///
-/// let mut hasher = Koopman8P::new();
-/// hasher.update(b"Hello");
-/// let checksum = hasher.finalize();
-/// let parity_bit = checksum & 1;
+/// let mut hasher = Koopman8Fixed::<MODULUS_8>::new();
+/// hasher.update(b"test data");
+/// assert_eq!(hasher.finalize(), koopman8(b"test data", 0));
 /// ```
 #[derive(Clone, Debug)]
-pub struct Koopman8P {
+pub struct Koopman8Fixed<const M: u32> {
     sum: u32,
-    psum: u8,
-    modulus: u32,
     seed: u32,
     initialized: bool,
 }
 
-impl_streaming_parity_hasher!(
-    Koopman8P, u32, u8,
-    MODULUS_7P, NonZeroU32,
-    1
-);
+impl_fixed_hasher!(Koopman8Fixed, u32, u8, 1);
 
-/// Incremental Koopman16P checksum calculator (15-bit checksum + 1 parity bit).
+/// Incremental Koopman16 checksum calculator with a compile-time modulus.
 ///
-/// Allows computing checksums over data that arrives in chunks.
+/// Equivalent to [`Koopman16`] with the same modulus, but the reduction is
+/// constant-folded and the struct holds no runtime modulus state.
 ///
 /// # Example
 /// ```rust
-/// use koopman_checksum::Koopman16P;
+/// use koopman_checksum::{koopman16, Koopman16Fixed, MODULUS_16};
 ///
-/// let mut hasher = Koopman16P::new();
-/// hasher.update(b"Hello, ");
-/// hasher.update(b"World!");
-/// let checksum = hasher.finalize();
-/// let parity_bit = checksum & 1;
+/// let mut hasher = Koopman16Fixed::<MODULUS_16>::new();
+/// hasher.update(b"test data");
+/// assert_eq!(hasher.finalize(), koopman16(b"test data", 0));
 /// ```
 #[derive(Clone, Debug)]
-pub struct Koopman16P {
+pub struct Koopman16Fixed<const M: u32> {
     sum: u32,
-    psum: u8,
-    modulus: u32,
     seed: u32,
     initialized: bool,
 }
 
-impl_streaming_parity_hasher!(
-    Koopman16P, u32, u16,
-    MODULUS_15P, NonZeroU32,
-    2
-);
+impl_fixed_hasher!(Koopman16Fixed, u32, u16, 2);
 
-/// Incremental Koopman32P checksum calculator (31-bit checksum + 1 parity bit).
+/// Incremental Koopman32 checksum calculator with a compile-time modulus.
 ///
-/// Allows computing checksums over data that arrives in chunks.
+/// Equivalent to [`Koopman32`] with the same modulus, but the reduction is
+/// constant-folded and the struct holds no runtime modulus state.
 ///
 /// # Example
 /// ```rust
-/// use koopman_checksum::Koopman32P;
+/// use koopman_checksum::{koopman32, Koopman32Fixed, MODULUS_32};
 ///
-/// let mut hasher = Koopman32P::new();
-/// hasher.update(b"Hello, ");
-/// hasher.update(b"World!");
-/// let checksum = hasher.finalize();
-/// let parity_bit = checksum & 1;
+/// let mut hasher = Koopman32Fixed::<MODULUS_32>::new();
+/// hasher.update(b"test data");
+/// assert_eq!(hasher.finalize(), koopman32(b"test data", 0));
 /// ```
 #[derive(Clone, Debug)]
-pub struct Koopman32P {
+pub struct Koopman32Fixed<const M: u64> {
     sum: u64,
-    psum: u8,
-    modulus: u64,
     seed: u64,
     initialized: bool,
 }
 
-impl_streaming_parity_hasher!(
-    Koopman32P, u64, u32,
-    MODULUS_31P, NonZeroU64,
-    4
-);
+impl_fixed_hasher!(Koopman32Fixed, u64, u32, 4);
 
 // ============================================================================
 // Verification Functions
@@ -1008,7 +3822,31 @@ pub fn verify16(data: &[u8], expected: u16, initial_seed: u8) -> bool {
     koopman16(data, initial_seed) == expected
 }
 
-/// Verify data integrity using Koopman32 checksum.
+/// Verify data integrity using Koopman32 checksum.
+///
+/// # Arguments
+/// * `data` - The data bytes (excluding checksum)
+/// * `expected` - The expected checksum value
+/// * `initial_seed` - Initial seed used when computing the checksum
+///
+/// # Returns
+/// `true` if the checksum matches, `false` otherwise
+///
+/// # Example
+/// ```rust
+/// use koopman_checksum::{koopman32, verify32};
+///
+/// let data = b"test data";
+/// let checksum = koopman32(data, 0xee);
+/// assert!(verify32(data, checksum, 0xee));
+/// ```
+#[inline]
+#[must_use]
+pub fn verify32(data: &[u8], expected: u32, initial_seed: u8) -> bool {
+    koopman32(data, initial_seed) == expected
+}
+
+/// Verify data integrity using Koopman64 checksum.
 ///
 /// # Arguments
 /// * `data` - The data bytes (excluding checksum)
@@ -1020,16 +3858,16 @@ pub fn verify16(data: &[u8], expected: u16, initial_seed: u8) -> bool {
 ///
 /// # Example
 /// ```rust
-/// use koopman_checksum::{koopman32, verify32};
+/// use koopman_checksum::{koopman64, verify64};
 ///
 /// let data = b"test data";
-/// let checksum = koopman32(data, 0xee);
-/// assert!(verify32(data, checksum, 0xee));
+/// let checksum = koopman64(data, 0xee);
+/// assert!(verify64(data, checksum, 0xee));
 /// ```
 #[inline]
 #[must_use]
-pub fn verify32(data: &[u8], expected: u32, initial_seed: u8) -> bool {
-    koopman32(data, initial_seed) == expected
+pub fn verify64(data: &[u8], expected: u64, initial_seed: u8) -> bool {
+    koopman64(data, initial_seed) == expected
 }
 
 /// Verify data integrity using Koopman8P checksum (with parity).
@@ -1179,6 +4017,97 @@ mod tests {
         assert_eq!(full, streaming);
     }
 
+    #[test]
+    fn test_koopman64_empty() {
+        assert_eq!(koopman64(&[], 0), 0);
+        assert_eq!(koopman64(&[], 42), 0); // Empty data returns 0 regardless of initial seed
+    }
+
+    #[test]
+    fn test_koopman64_matches_reference() {
+        // Independent byte-at-a-time computation in u128 arithmetic
+        fn reference(data: &[u8], seed: u8) -> u64 {
+            if data.is_empty() {
+                return 0;
+            }
+            let mut sum: u128 = (data[0] ^ seed) as u128;
+            for &byte in &data[1..] {
+                sum = ((sum << 8) + byte as u128) % MODULUS_64;
+            }
+            for _ in 0..8 {
+                sum = (sum << 8) % MODULUS_64;
+            }
+            sum as u64
+        }
+
+        for len in 0usize..=64 {
+            let data: Vec<u8> = (0..len).map(|i| (i.wrapping_mul(31).wrapping_add(7)) as u8).collect();
+            for seed in [0u8, 0xee] {
+                assert_eq!(
+                    koopman64(&data, seed),
+                    reference(&data, seed),
+                    "mismatch at len {} seed {}", len, seed
+                );
+            }
+        }
+    }
+
+    #[test]
+    fn test_streaming_koopman64() {
+        let full = koopman64(TEST_DATA, 0);
+
+        let mut hasher = Koopman64::new();
+        hasher.update(&TEST_DATA[..4]);
+        hasher.update(&TEST_DATA[4..]);
+        let streaming = hasher.finalize();
+
+        assert_eq!(full, streaming);
+
+        let mut seeded = Koopman64::with_seed(0xee);
+        seeded.update(TEST_DATA);
+        assert_eq!(seeded.finalize(), koopman64(TEST_DATA, 0xee));
+    }
+
+    #[test]
+    fn test_verify64() {
+        let data = b"test data";
+        let checksum = koopman64(data, 0xee);
+        assert!(verify64(data, checksum, 0xee));
+        assert!(!verify64(data, checksum.wrapping_add(1), 0xee));
+    }
+
+    #[test]
+    fn test_koopman16_word_kernel_matches_generic() {
+        // The 8-byte word kernel must agree with the generic byte-at-a-time
+        // path at every length, including the head/tail boundary cases.
+        for len in 0usize..=64 {
+            let data: Vec<u8> = (0..len).map(|i| (i.wrapping_mul(31).wrapping_add(7)) as u8).collect();
+            for seed in [0u8, 0xee] {
+                assert_eq!(
+                    koopman16(&data, seed),
+                    koopman16_with_modulus(&data, seed, NONZERO_MODULUS_16),
+                    "mismatch at len {} seed {}", len, seed
+                );
+            }
+        }
+    }
+
+    #[test]
+    fn test_koopman32_word_kernel_matches_generic() {
+        // The 8-byte word kernel must agree with the generic byte-at-a-time
+        // path at every length, including the head/tail boundary cases.
+        for len in 0usize..=64 {
+            let data: Vec<u8> = (0..len).map(|i| (i.wrapping_mul(31).wrapping_add(7)) as u8).collect();
+            for seed in [0u8, 0xee] {
+                assert_eq!(
+                    koopman32(&data, seed),
+                    koopman32_with_modulus(&data, seed, NONZERO_MODULUS_32),
+                    "mismatch at len {} seed {}", len, seed
+                );
+            }
+        }
+    }
+
     #[test]
     fn test_seed_affects_result() {
         let result0 = koopman16(TEST_DATA, 0);
@@ -1340,6 +4269,471 @@ mod tests {
         assert_eq!(expected, streaming);
     }
 
+    #[test]
+    fn test_barrett_reduction_exact() {
+        for modulus in [1u32, 2, 3, 239, 253, 32749, 65519, 16_777_213] {
+            let rcp = barrett_rcp_u32(modulus);
+            for x in (0u32..100_000).chain((u32::MAX - 100_000)..=u32::MAX) {
+                assert_eq!(barrett_mod_u32(x, modulus, rcp), x % modulus);
+            }
+        }
+
+        for modulus in [1u64, 2, 2147483629, 4294967291, (1 << 40) - 87] {
+            let rcp = barrett_rcp_u64(modulus);
+            for x in (0u64..100_000).chain((u64::MAX - 100_000)..=u64::MAX) {
+                assert_eq!(barrett_mod_u64(x, modulus, rcp), x % modulus);
+            }
+        }
+    }
+
+    // ========================================================================
+    // Tests for checksum combination
+    // ========================================================================
+
+    #[test]
+    fn test_combine_matches_one_shot() {
+        let data = b"test data for combining shards";
+        let seed = 0xee;
+
+        // Every split point, including empty A and empty B
+        for split in 0..=data.len() {
+            let (a, b) = data.split_at(split);
+            let use_seed = if a.is_empty() { 0 } else { seed };
+
+            assert_eq!(
+                koopman8_combine(koopman8(a, use_seed), koopman8(b, 0), b.len()),
+                koopman8(data, use_seed),
+                "koopman8 split {}", split
+            );
+            assert_eq!(
+                koopman16_combine(koopman16(a, use_seed), koopman16(b, 0), b.len()),
+                koopman16(data, use_seed),
+                "koopman16 split {}", split
+            );
+            assert_eq!(
+                koopman32_combine(koopman32(a, use_seed), koopman32(b, 0), b.len()),
+                koopman32(data, use_seed),
+                "koopman32 split {}", split
+            );
+            assert_eq!(
+                koopman8p_combine(koopman8p(a, use_seed), koopman8p(b, 0), b.len()),
+                koopman8p(data, use_seed),
+                "koopman8p split {}", split
+            );
+            assert_eq!(
+                koopman16p_combine(koopman16p(a, use_seed), koopman16p(b, 0), b.len()),
+                koopman16p(data, use_seed),
+                "koopman16p split {}", split
+            );
+            assert_eq!(
+                koopman32p_combine(koopman32p(a, use_seed), koopman32p(b, 0), b.len()),
+                koopman32p(data, use_seed),
+                "koopman32p split {}", split
+            );
+        }
+    }
+
+    #[test]
+    fn test_combine_multiple_shards() {
+        // Fold several shards left to right, as a distributed verifier would
+        let data: Vec<u8> = (0..1000).map(|i| (i % 251) as u8).collect();
+        let seed = 0x42;
+        let expected = koopman32(&data, seed);
+
+        let mut acc = 0u32;
+        let mut first = true;
+        for shard in data.chunks(237) {
+            let part = koopman32(shard, if first { seed } else { 0 });
+            acc = if first { part } else { koopman32_combine(acc, part, shard.len()) };
+            first = false;
+        }
+
+        assert_eq!(acc, expected);
+    }
+
+    #[cfg(feature = "parallel")]
+    #[test]
+    fn test_parallel_matches_sequential() {
+        // Below threshold (sequential fallback) and above threshold, with
+        // sizes that don't divide evenly across threads
+        for len in [0, 1, 4096, PARALLEL_THRESHOLD + 12345] {
+            let data: Vec<u8> = (0..len).map(|i| (i % 251) as u8).collect();
+            for seed in [0u8, 0xee] {
+                assert_eq!(
+                    koopman32_parallel(&data, seed),
+                    koopman32(&data, seed),
+                    "mismatch at len {} seed {}", len, seed
+                );
+            }
+        }
+    }
+
+    // ========================================================================
+    // Tests for the chunked tree checksum
+    // ========================================================================
+
+    #[cfg(feature = "std")]
+    #[test]
+    fn test_tree_verify_and_root() {
+        // Length deliberately not a multiple of the chunk size; the
+        // pattern's period (251) does not divide the chunk size, so no
+        // two chunks are identical
+        let object: Vec<u8> = (0..10_000usize).map(|i| (i % 251) as u8).collect();
+        let tree = KoopmanTree32::build(&object, 1024);
+
+        assert_eq!(tree.num_chunks(), 10);
+        assert_eq!(tree.chunk_len(9), Some(10_000 - 9 * 1024));
+        assert_eq!(tree.root(), koopman32(&object, 0));
+
+        for (index, chunk) in object.chunks(1024).enumerate() {
+            assert!(tree.verify_chunk(index, chunk));
+        }
+
+        // A corrupted chunk, a wrong index, and a truncated read all fail
+        let mut bad = object[1024..2048].to_vec();
+        bad[17] ^= 0x40;
+        assert!(!tree.verify_chunk(1, &bad));
+        assert!(!tree.verify_chunk(2, &object[1024..2048]));
+        assert!(!tree.verify_chunk(1, &object[1024..2000]));
+        assert!(!tree.verify_chunk(10, &[]));
+
+        // Empty object: no leaves, root 0
+        let empty = KoopmanTree32::build(&[], 1024);
+        assert_eq!(empty.num_chunks(), 0);
+        assert_eq!(empty.root(), 0);
+    }
+
+    #[cfg(feature = "std")]
+    #[test]
+    fn test_tree_serialization_round_trip() {
+        let object: Vec<u8> = (0..5000usize).map(|i| (i * 7 + 3) as u8).collect();
+        let tree = KoopmanTree32::build(&object, 512);
+
+        let bytes = tree.to_bytes();
+        assert_eq!(KoopmanTree32::from_bytes(&bytes), Some(tree.clone()));
+
+        // Bad magic, truncated body, and inconsistent leaf count are
+        // rejected
+        let mut bad_magic = bytes.clone();
+        bad_magic[0] ^= 0xFF;
+        assert_eq!(KoopmanTree32::from_bytes(&bad_magic), None);
+        assert_eq!(KoopmanTree32::from_bytes(&bytes[..bytes.len() - 4]), None);
+        assert_eq!(KoopmanTree32::from_bytes(&[]), None);
+
+        let mut extra = bytes.clone();
+        extra.extend_from_slice(&[0; 4]);
+        assert_eq!(KoopmanTree32::from_bytes(&extra), None);
+
+        // Hostile headers whose leaf-count math overflows u64 must be
+        // rejected, not wrapped into a spuriously matching body length
+        for total_len in [u64::MAX, 1u64 << 62] {
+            let mut hostile = bytes[..9].to_vec();
+            hostile[5..9].copy_from_slice(&1u32.to_be_bytes());
+            hostile.extend_from_slice(&total_len.to_be_bytes());
+            assert_eq!(KoopmanTree32::from_bytes(&hostile), None);
+        }
+    }
+
+    #[cfg(all(feature = "std", feature = "parallel"))]
+    #[test]
+    fn test_tree_build_parallel_matches_sequential() {
+        let object: Vec<u8> = (0..100_000usize).map(|i| (i * 31 + 7) as u8).collect();
+        assert_eq!(
+            KoopmanTree32::build_parallel(&object, 4096),
+            KoopmanTree32::build(&object, 4096)
+        );
+    }
+
+    // ========================================================================
+    // Tests for the batch API
+    // ========================================================================
+
+    #[test]
+    fn test_batch_matches_one_shot() {
+        // Mixed lengths (including empty and sub-word messages), a count
+        // that is not a multiple of four, and both seeds
+        let backing: Vec<Vec<u8>> = (0..23)
+            .map(|i| (0..(i * 13) % 200).map(|j| (i * 7 + j) as u8).collect())
+            .collect();
+        let msgs: Vec<&[u8]> = backing.iter().map(|v| v.as_slice()).collect();
+
+        for seed in [0u8, 0xee] {
+            let mut out = vec![0u16; msgs.len()];
+            koopman16_batch_into(&msgs, seed, &mut out);
+            for (i, msg) in msgs.iter().enumerate() {
+                assert_eq!(out[i], koopman16(msg, seed), "message {} seed {}", i, seed);
+            }
+
+            #[cfg(feature = "std")]
+            assert_eq!(koopman16_batch(&msgs, seed), out);
+        }
+    }
+
+    // ========================================================================
+    // Tests for the vectored (scatter-gather) entry points
+    // ========================================================================
+
+    #[test]
+    fn test_vectored_matches_contiguous() {
+        let data: Vec<u8> = (0..300usize).map(|i| (i * 31 + 7) as u8).collect();
+
+        // Segmentations covering empty segments, single-byte segments,
+        // word-aligned splits, and splits that straddle word boundaries
+        let splits: &[&[usize]] = &[
+            &[],
+            &[0],
+            &[1],
+            &[1, 2, 3],
+            &[8, 16],
+            &[3, 11, 40],
+            &[0, 5, 0, 7],
+            &[100, 100, 100],
+            &[1, 0, 298, 1],
+            &[13, 29, 31, 64, 163],
+        ];
+
+        for sizes in splits {
+            let mut segments: Vec<&[u8]> = Vec::new();
+            let mut offset = 0;
+            for &size in *sizes {
+                segments.push(&data[offset..offset + size]);
+                offset += size;
+            }
+            let whole = &data[..offset];
+
+            for seed in [0u8, 0xee] {
+                assert_eq!(
+                    koopman16_vectored(&segments, seed),
+                    koopman16(whole, seed),
+                    "16-bit, sizes {:?} seed {}",
+                    sizes,
+                    seed
+                );
+                assert_eq!(
+                    koopman32_vectored(&segments, seed),
+                    koopman32(whole, seed),
+                    "32-bit, sizes {:?} seed {}",
+                    sizes,
+                    seed
+                );
+            }
+        }
+    }
+
+    // ========================================================================
+    // Tests for the fixed-length entry point
+    // ========================================================================
+
+    #[test]
+    fn test_fixed_length_matches_generic() {
+        macro_rules! check {
+            ($($n:literal),*) => {
+                $(
+                    let data: [u8; $n] = core::array::from_fn(|i| (i * 31 + 7) as u8);
+                    for seed in [0u8, 0xee] {
+                        assert_eq!(
+                            koopman16_fixed(&data, seed),
+                            koopman16(&data, seed),
+                            "length {} seed {}", $n, seed
+                        );
+                    }
+                )*
+            };
+        }
+        // Cover empty input, sub-word lengths, exact word multiples, and
+        // every tail offset
+        check!(0, 1, 2, 3, 7, 8, 9, 10, 15, 16, 17, 47, 48, 49, 64, 128, 1500);
+    }
+
+    // ========================================================================
+    // Tests for incremental range updates
+    // ========================================================================
+
+    #[test]
+    fn test_update_range_matches_recompute() {
+        let seed = 0xee;
+        let original: Vec<u8> = (0..500).map(|i| (i * 11 + 3) as u8).collect();
+        let before = koopman32(&original, seed);
+
+        // Edits at the start (seeded byte), middle, end, single byte, and
+        // the whole buffer
+        let cases: &[(usize, usize)] = &[(0, 16), (0, 1), (200, 16), (499, 1), (484, 16), (0, 500)];
+        for &(offset, len) in cases {
+            let mut edited = original.clone();
+            for (i, b) in edited[offset..offset + len].iter_mut().enumerate() {
+                *b = b.wrapping_add((i as u8).wrapping_add(1));
+            }
+            let patched = koopman32_update_range(
+                before,
+                original.len(),
+                offset,
+                &original[offset..offset + len],
+                &edited[offset..offset + len],
+                seed,
+            );
+            assert_eq!(
+                patched,
+                koopman32(&edited, seed),
+                "mismatch for edit at offset {} len {}", offset, len
+            );
+        }
+
+        // Empty edit is the identity
+        assert_eq!(
+            koopman32_update_range(before, original.len(), 10, &[], &[], seed),
+            before
+        );
+    }
+
+    // ========================================================================
+    // Tests for rolling-window hashers
+    // ========================================================================
+
+    #[test]
+    fn test_rolling_matches_one_shot() {
+        let data: Vec<u8> = (0..300).map(|i| (i * 7 + 13) as u8).collect();
+
+        let mut r16 = KoopmanRolling16::<48>::new();
+        let mut r32 = KoopmanRolling32::<48>::new();
+        for (i, &byte) in data.iter().enumerate() {
+            r16.push(byte);
+            r32.push(byte);
+            let start = (i + 1).saturating_sub(48);
+            let window = &data[start..=i];
+            assert_eq!(r16.checksum(), koopman16(window, 0), "16-bit at byte {}", i);
+            assert_eq!(r32.checksum(), koopman32(window, 0), "32-bit at byte {}", i);
+        }
+    }
+
+    #[test]
+    fn test_rolling_window_of_one() {
+        let mut rolling = KoopmanRolling32::<1>::new();
+        assert_eq!(rolling.checksum(), 0);
+        for &byte in b"abc" {
+            rolling.push(byte);
+            assert_eq!(rolling.checksum(), koopman32(&[byte], 0));
+        }
+        assert!(rolling.is_full());
+    }
+
+    #[test]
+    fn test_rolling_reset() {
+        let mut rolling = KoopmanRolling16::<8>::new();
+        for &byte in b"junk data" {
+            rolling.push(byte);
+        }
+        rolling.reset();
+        assert!(rolling.is_empty());
+        for &byte in b"test" {
+            rolling.push(byte);
+        }
+        assert_eq!(rolling.checksum(), koopman16(b"test", 0));
+    }
+
+    // ========================================================================
+    // Tests for const-generic hashers
+    // ========================================================================
+
+    #[test]
+    fn test_fixed_hashers_match_runtime() {
+        let data = b"test data for fixed-modulus hashers";
+        let seed = 42u8;
+
+        let mut h8 = Koopman8Fixed::<MODULUS_8>::with_seed(seed);
+        h8.update(&data[..10]);
+        h8.update(&data[10..]);
+        assert_eq!(h8.finalize(), koopman8(data, seed));
+
+        let mut h16 = Koopman16Fixed::<MODULUS_16>::with_seed(seed);
+        h16.update(&data[..10]);
+        h16.update(&data[10..]);
+        assert_eq!(h16.finalize(), koopman16(data, seed));
+
+        let mut h32 = Koopman32Fixed::<MODULUS_32>::with_seed(seed);
+        h32.update(&data[..10]);
+        h32.update(&data[10..]);
+        assert_eq!(h32.finalize(), koopman32(data, seed));
+
+        // Non-default modulus agrees with the runtime-modulus hasher
+        let mut fixed = Koopman16Fixed::<32749>::new();
+        fixed.update(data);
+        let mut runtime = Koopman16::with_modulus(NonZeroU32::new(32749).unwrap());
+        runtime.update(data);
+        assert_eq!(fixed.finalize(), runtime.finalize());
+    }
+
+    #[test]
+    fn test_fixed_hasher_reset_and_empty() {
+        let empty = Koopman16Fixed::<MODULUS_16>::new();
+        assert_eq!(empty.finalize(), 0);
+
+        let mut h = Koopman16Fixed::<MODULUS_16>::with_seed(7);
+        h.update(b"junk");
+        h.reset();
+        h.update(b"test");
+        assert_eq!(h.finalize(), koopman16(b"test", 7));
+    }
+
+    // ========================================================================
+    // Tests for compile-time evaluation
+    // ========================================================================
+
+    #[test]
+    fn test_const_fns_match_runtime() {
+        let patterns: [&[u8]; 4] = [b"", b"A", b"test data", &[0xff; 300]];
+        for data in patterns {
+            for seed in [0u8, 0xee] {
+                assert_eq!(koopman8_const(data, seed), koopman8(data, seed));
+                assert_eq!(koopman16_const(data, seed), koopman16(data, seed));
+                assert_eq!(koopman32_const(data, seed), koopman32(data, seed));
+                assert_eq!(koopman64_const(data, seed), koopman64(data, seed));
+                assert_eq!(koopman8p_const(data, seed), koopman8p(data, seed));
+                assert_eq!(koopman16p_const(data, seed), koopman16p(data, seed));
+                assert_eq!(koopman32p_const(data, seed), koopman32p(data, seed));
+            }
+        }
+    }
+
+    #[test]
+    fn test_const_fns_evaluate_in_const_context() {
+        // The motivating use case: a static blob carrying its checksum,
+        // both baked into the binary
+        const BLOB: &[u8] = b"embedded configuration blob";
+        const CS: u16 = koopman16_const(BLOB, 0);
+        const CS_P: u16 = koopman16p_const(BLOB, 0xee);
+        assert_eq!(CS, koopman16(BLOB, 0));
+        assert_eq!(CS_P, koopman16p(BLOB, 0xee));
+    }
+
+    // ========================================================================
+    // Tests for runtime kernel dispatch
+    // ========================================================================
+
+    #[test]
+    fn test_kernel_dispatch_query_and_override() {
+        // Pinning either kernel never changes results, so racing tests in
+        // other threads see bit-identical checksums regardless of ordering
+        let data = vec![0xA5u8; 4096];
+        let seed = 0xee;
+
+        assert!(override_kernel(Kernel::Scalar));
+        assert_eq!(selected_kernel(), Kernel::Scalar);
+        let scalar16 = koopman16(&data, seed);
+        let scalar32 = koopman32(&data, seed);
+
+        if override_kernel(Kernel::Avx2) {
+            assert_eq!(selected_kernel(), Kernel::Avx2);
+            assert_eq!(koopman16(&data, seed), scalar16);
+            assert_eq!(koopman32(&data, seed), scalar32);
+        } else {
+            // Rejected overrides leave the selection unchanged
+            assert_eq!(selected_kernel(), Kernel::Scalar);
+        }
+
+        #[cfg(not(all(feature = "simd", target_arch = "x86_64")))]
+        assert!(!override_kernel(Kernel::Avx2));
+    }
+
     // ========================================================================
     // Tests for reset behavior
     // ========================================================================
@@ -1480,6 +4874,55 @@ mod tests {
         assert_eq!(hasher_with_seed.finalize(), 0);
     }
 
+    #[test]
+    fn test_update_zeros_matches_explicit() {
+        macro_rules! check {
+            ($hasher:ty, $one_shot:expr) => {
+                // Zero runs in the middle, at the start (seeded first
+                // byte), and n == 0
+                for (prefix, n, suffix) in [
+                    (b"header".as_slice(), 4096usize, b"trailer".as_slice()),
+                    (b"".as_slice(), 100, b"data".as_slice()),
+                    (b"x".as_slice(), 1, b"".as_slice()),
+                    (b"abc".as_slice(), 0, b"def".as_slice()),
+                ] {
+                    for seed in [0u8, 0xee] {
+                        let mut hasher = <$hasher>::with_seed(seed);
+                        hasher.update(prefix);
+                        hasher.update_zeros(n);
+                        hasher.update(suffix);
+
+                        let mut data = prefix.to_vec();
+                        data.resize(prefix.len() + n, 0);
+                        data.extend_from_slice(suffix);
+                        assert_eq!(hasher.finalize(), $one_shot(&data, seed));
+                    }
+                }
+            };
+        }
+        check!(Koopman8, koopman8);
+        check!(Koopman16, koopman16);
+        check!(Koopman32, koopman32);
+        check!(Koopman64, koopman64);
+        check!(Koopman16P, koopman16p);
+        check!(Koopman32P, koopman32p);
+    }
+
+    #[test]
+    fn test_update_zeros_with_custom_modulus() {
+        let modulus = NonZeroU32::new(32749).unwrap();
+
+        let mut hasher = Koopman16::with_modulus(modulus);
+        hasher.update(b"sparse");
+        hasher.update_zeros(5000);
+        hasher.update(b"image");
+
+        let mut data = b"sparse".to_vec();
+        data.resize(6 + 5000, 0);
+        data.extend_from_slice(b"image");
+        assert_eq!(hasher.finalize(), koopman16_with_modulus(&data, 0, modulus));
+    }
+
     #[test]
     fn test_streaming_parity_koopman8p() {
         let data = b"test";
@@ -1533,6 +4976,292 @@ mod tests {
         assert_eq!(expected, streaming);
     }
 
+    #[test]
+    fn test_parity_fast_path_matches_barrett() {
+        // The default-modulus fast path (word kernel plus wide parity
+        // pass) must agree with the generic Barrett path at every length,
+        // covering the seeded first byte, partial words, and tail offsets
+        let data: Vec<u8> = (0..256usize).map(|i| (i * 31 + 7) as u8).collect();
+        let m7 = NonZeroU32::new(MODULUS_7P).unwrap();
+        let m15 = NonZeroU32::new(MODULUS_15P).unwrap();
+        let m31 = NonZeroU64::new(MODULUS_31P).unwrap();
+
+        for len in (0..=64).chain([255, 256]) {
+            for seed in [0u8, 0xee] {
+                let d = &data[..len];
+                assert_eq!(
+                    koopman8p(d, seed),
+                    koopman8p_with_modulus(d, seed, m7),
+                    "koopman8p len {} seed {}",
+                    len,
+                    seed
+                );
+                assert_eq!(
+                    koopman16p(d, seed),
+                    koopman16p_with_modulus(d, seed, m15),
+                    "koopman16p len {} seed {}",
+                    len,
+                    seed
+                );
+                assert_eq!(
+                    koopman32p(d, seed),
+                    koopman32p_with_modulus(d, seed, m31),
+                    "koopman32p len {} seed {}",
+                    len,
+                    seed
+                );
+            }
+        }
+    }
+
+    // ========================================================================
+    // Tests for hasher state checkpointing
+    // ========================================================================
+
+    #[test]
+    fn test_state_round_trip() {
+        // Checkpoint mid-stream, resume from the serialized state, and
+        // check the result against hashing the whole input in one piece
+        let data: Vec<u8> = (0..300usize).map(|i| (i * 17 + 3) as u8).collect();
+        let (head, tail) = data.split_at(150);
+
+        macro_rules! check {
+            ($name:ident, $oneshot:ident) => {
+                let mut hasher = $name::with_seed(0xee);
+                hasher.update(head);
+                let mut resumed = $name::from_state(&hasher.state()).unwrap();
+                resumed.update(tail);
+                assert_eq!(resumed.finalize(), $oneshot(&data, 0xee));
+            };
+        }
+        check!(Koopman8, koopman8);
+        check!(Koopman16, koopman16);
+        check!(Koopman32, koopman32);
+        check!(Koopman64, koopman64);
+        check!(Koopman8P, koopman8p);
+        check!(Koopman16P, koopman16p);
+        check!(Koopman32P, koopman32p);
+    }
+
+    #[test]
+    fn test_state_preserves_modulus_and_seed() {
+        // A custom modulus survives the round trip, including the derived
+        // Barrett reciprocal and fast-path flag
+        let modulus = NonZeroU32::new(32749).unwrap();
+        let mut hasher = Koopman16::with_modulus(modulus);
+        hasher.update(b"check");
+        let mut resumed = Koopman16::from_state(&hasher.state()).unwrap();
+        resumed.update(b"point");
+        assert_eq!(
+            resumed.finalize(),
+            koopman16_with_modulus(b"checkpoint", 0, modulus)
+        );
+
+        // reset() after resume falls back to the original seed
+        let hasher = Koopman32::with_seed(0xee);
+        let mut resumed = Koopman32::from_state(&hasher.state()).unwrap();
+        resumed.update(b"data");
+        resumed.reset();
+        resumed.update(b"data");
+        assert_eq!(resumed.finalize(), koopman32(b"data", 0xee));
+    }
+
+    #[test]
+    fn test_state_rejects_invalid_bytes() {
+        // An uninitialized hasher round-trips (finalize stays 0)
+        let resumed = Koopman16::from_state(&Koopman16::new().state()).unwrap();
+        assert_eq!(resumed.finalize(), 0);
+
+        // Zero modulus and out-of-range flag bytes are rejected
+        let mut state = Koopman16::new().state();
+        state[4..8].fill(0);
+        assert!(Koopman16::from_state(&state).is_none());
+        let mut state = Koopman16::new().state();
+        state[9] = 2;
+        assert!(Koopman16::from_state(&state).is_none());
+        let mut state = Koopman64::new().state();
+        state[9] = 2;
+        assert!(Koopman64::from_state(&state).is_none());
+
+        // The documented sizes match the layouts
+        assert_eq!(Koopman16::new().state().len(), Koopman16::STATE_SIZE);
+        assert_eq!(Koopman32::new().state().len(), Koopman32::STATE_SIZE);
+        assert_eq!(Koopman16P::new().state().len(), Koopman16P::STATE_SIZE);
+        assert_eq!(Koopman64::new().state().len(), Koopman64::STATE_SIZE);
+    }
+
+    // ========================================================================
+    // Tests for trait integrations
+    // ========================================================================
+
+    #[test]
+    fn test_core_hasher_impl() {
+        use core::hash::Hasher as _;
+
+        let data = b"test data";
+
+        let mut hasher = Koopman32::new();
+        hasher.write(&data[..4]);
+        hasher.write(&data[4..]);
+        assert_eq!(hasher.finish(), koopman32(data, 0) as u64);
+
+        // finish() peeks at the current value: feeding more data
+        // afterwards still works
+        hasher.write(b"!");
+        assert_eq!(hasher.finish(), koopman32(b"test data!", 0) as u64);
+
+        let mut hasher = Koopman16::new();
+        hasher.write(data);
+        assert_eq!(hasher.finish(), koopman16(data, 0) as u64);
+    }
+
+    #[cfg(feature = "digest")]
+    #[test]
+    fn test_digest_impl() {
+        use digest::Digest;
+
+        // Through the generic Digest interface, as a framing layer would
+        // use it
+        fn frame_checksum<D: Digest>(payload: &[u8]) -> digest::Output<D> {
+            let mut hasher = D::new();
+            Digest::update(&mut hasher, payload);
+            hasher.finalize()
+        }
+
+        let data = b"test data";
+        assert_eq!(
+            frame_checksum::<Koopman16>(data).as_slice(),
+            &koopman16(data, 0).to_be_bytes()
+        );
+        assert_eq!(
+            frame_checksum::<Koopman32>(data).as_slice(),
+            &koopman32(data, 0).to_be_bytes()
+        );
+        assert_eq!(
+            frame_checksum::<Koopman64>(data).as_slice(),
+            &koopman64(data, 0).to_be_bytes()
+        );
+
+        // finalize_reset leaves the hasher ready for the next record
+        let mut hasher = Koopman32::new();
+        Digest::update(&mut hasher, data);
+        let first = hasher.finalize_reset();
+        Digest::update(&mut hasher, data);
+        assert_eq!(Digest::finalize(hasher), first);
+    }
+
+    #[cfg(feature = "std")]
+    #[test]
+    fn test_checksum_writer_reader() {
+        use std::io::{Read, Write};
+
+        let data: Vec<u8> = (0..1000).map(|i| (i * 7 + 1) as u8).collect();
+        let expected = koopman32(&data, 0) as u64;
+
+        let mut writer = ChecksumWriter::new(Vec::new());
+        for chunk in data.chunks(97) {
+            writer.write_all(chunk).unwrap();
+        }
+        assert_eq!(writer.checksum(), expected);
+        let (written, _) = writer.into_parts();
+        assert_eq!(written, data);
+
+        let mut reader = ChecksumReader::new(data.as_slice());
+        let mut out = Vec::new();
+        reader.read_to_end(&mut out).unwrap();
+        assert_eq!(out, data);
+        assert_eq!(reader.checksum(), expected);
+
+        // A seeded hasher and a different width via with_hasher
+        let mut writer = ChecksumWriter::with_hasher(Vec::new(), Koopman16::with_seed(0xee));
+        writer.write_all(&data).unwrap();
+        assert_eq!(writer.checksum(), koopman16(&data, 0xee) as u64);
+    }
+
+    // ========================================================================
+    // Tests for the frame format
+    // ========================================================================
+
+    #[cfg(feature = "std")]
+    #[test]
+    fn test_frame_round_trip() {
+        let payloads: [&[u8]; 4] = [b"first", b"", b"a longer third record", b"\x00\x00\x00"];
+
+        let mut writer = FrameWriter::new(Vec::new());
+        for payload in payloads {
+            writer.write_frame(payload).unwrap();
+        }
+        let stream = writer.into_inner();
+
+        // Each frame carries 6 bytes of overhead: length prefix + checksum
+        let total: usize = payloads.iter().map(|p| p.len() + 6).sum();
+        assert_eq!(stream.len(), total);
+
+        let mut reader = FrameReader::new(&stream);
+        for payload in payloads {
+            assert_eq!(reader.next_frame().unwrap(), Some(payload));
+        }
+        assert_eq!(reader.next_frame().unwrap(), None);
+        assert_eq!(reader.position(), stream.len());
+    }
+
+    #[test]
+    fn test_frame_layout() {
+        // The frame format is a wire format: pin the exact byte layout
+        // rather than relying on writer/reader symmetry alone
+        let payload = b"payload";
+        let mut frame = Vec::new();
+        frame.extend_from_slice(&(payload.len() as u32).to_be_bytes());
+        frame.extend_from_slice(payload);
+        frame.extend_from_slice(&koopman16p(&frame, 0).to_be_bytes());
+
+        let mut reader = FrameReader::new(&frame);
+        assert_eq!(reader.next_frame().unwrap(), Some(payload.as_slice()));
+        assert_eq!(reader.next_frame().unwrap(), None);
+    }
+
+    #[test]
+    fn test_frame_corruption_and_truncation() {
+        let payload = b"payload";
+        let mut frame = Vec::new();
+        frame.extend_from_slice(&(payload.len() as u32).to_be_bytes());
+        frame.extend_from_slice(payload);
+        frame.extend_from_slice(&koopman16p(&frame, 0).to_be_bytes());
+
+        // Flipping any bit — length prefix, payload, or checksum — is caught
+        for bit in 0..frame.len() * 8 {
+            let mut corrupted = frame.clone();
+            corrupted[bit / 8] ^= 1 << (bit % 8);
+            let mut reader = FrameReader::new(&corrupted);
+            assert!(
+                matches!(
+                    reader.next_frame(),
+                    Err(FrameError::ChecksumMismatch) | Err(FrameError::Truncated)
+                ),
+                "corruption at bit {} not detected",
+                bit
+            );
+            // The reader fuses after an error
+            assert_eq!(reader.next_frame(), Ok(None));
+        }
+
+        // Cutting the frame short at any point reports truncation
+        for len in 1..frame.len() {
+            let mut reader = FrameReader::new(&frame[..len]);
+            assert_eq!(reader.next_frame(), Err(FrameError::Truncated));
+        }
+
+        // Iterator form: a good frame followed by garbage yields the frame,
+        // then the error, then stops
+        let mut stream = frame.clone();
+        stream.extend_from_slice(&[0xFF; 4]);
+        let results: Vec<_> = FrameReader::new(&stream).collect();
+        assert_eq!(
+            results,
+            [Ok(payload.as_slice()), Err(FrameError::Truncated)]
+        );
+    }
+
     // ========================================================================
     // Tests for parity verification
     // ========================================================================
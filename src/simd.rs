@@ -0,0 +1,258 @@
+//! Opt-in AVX2 lane-split kernels for the 16- and 32-bit checksums.
+//!
+//! The byte-serial Horner recurrence cannot be vectorized directly, but its
+//! word-level form can: four interleaved Horner chains run in the four
+//! 64-bit lanes of a ymm register, each stepping by `256^32 mod m` per
+//! 32-byte block, and the lanes merge at the end with weights `256^24`,
+//! `256^16`, `256^8`, 1. This is the same restructuring used by vectorized
+//! CRC and polynomial-hash implementations.
+//!
+//! Results are bit-identical to the scalar kernels. The functions return
+//! `None` when the CPU lacks AVX2; callers fall back to the scalar
+//! implementations.
+
+// Copyright (c) 2025 the koopman-checksum authors, all rights reserved.
+// See README.md for licensing information.
+
+use crate::{fast_mod_4294967291, fast_mod_65519, pow_256_mod, MODULUS_16, MODULUS_32};
+use core::arch::x86_64::*;
+
+/// Inputs shorter than this gain nothing from the vector path: the merge
+/// and feature-detection overhead needs a few 32-byte blocks to amortize.
+/// The SIMD benchmark group puts the measured crossover between 256 bytes
+/// and 1 KiB on AVX2 hardware.
+pub const SIMD_THRESHOLD: usize = 512;
+
+// Powers of 256 mod 4294967291 = 2^32 - 5 (2^32 ≡ 5, so 256^8 = 2^64 ≡ 25)
+const K32_BLOCK: i64 = 390625; // 256^32 = 25^4
+const K32_LANE: [u64; 4] = [15625, 625, 25, 1]; // 256^24, 256^16, 256^8, 1
+
+// Powers of 256 mod 65519 = 2^16 - 17 (2^16 ≡ 17, so 256^8 = 2^64 ≡ 17^4)
+const K16_BLOCK: i64 = 56907; // 256^32 = 17^16
+const K16_LANE: [u64; 4] = [42109, 15030, 18002, 1]; // 256^24, 256^16, 256^8, 1
+
+/// Compute a 32-bit Koopman checksum with the AVX2 kernel.
+///
+/// Bit-identical to [`crate::koopman32`] with the default modulus.
+///
+/// # Returns
+/// The checksum, or `None` if the CPU does not support AVX2
+///
+/// # Example
+/// ```rust
+/// use koopman_checksum::{koopman32, simd};
+///
+/// let data = vec![0xAB; 4096];
+/// if let Some(checksum) = simd::koopman32(&data, 0xee) {
+///     assert_eq!(checksum, koopman32(&data, 0xee));
+/// }
+/// ```
+#[must_use]
+pub fn koopman32(data: &[u8], initial_seed: u8) -> Option<u32> {
+    if !std::arch::is_x86_feature_detected!("avx2") {
+        return None;
+    }
+    if data.is_empty() {
+        return Some(0);
+    }
+
+    let state = (data[0] ^ initial_seed) as u64;
+    // SAFETY: AVX2 presence checked above
+    let mut sum = unsafe { koopman32_avx2(&data[1..], state) };
+
+    // Append all four implicit zero bytes in one step: 2^32 ≡ 5
+    sum = fast_mod_4294967291(sum * 5);
+
+    Some(sum as u32)
+}
+
+/// Compute a 16-bit Koopman checksum with the AVX2 kernel.
+///
+/// Bit-identical to [`crate::koopman16`] with the default modulus.
+///
+/// # Returns
+/// The checksum, or `None` if the CPU does not support AVX2
+///
+/// # Example
+/// ```rust
+/// use koopman_checksum::{koopman16, simd};
+///
+/// let data = vec![0xAB; 1500];
+/// if let Some(checksum) = simd::koopman16(&data, 0xee) {
+///     assert_eq!(checksum, koopman16(&data, 0xee));
+/// }
+/// ```
+#[must_use]
+pub fn koopman16(data: &[u8], initial_seed: u8) -> Option<u16> {
+    if !std::arch::is_x86_feature_detected!("avx2") {
+        return None;
+    }
+    if data.is_empty() {
+        return Some(0);
+    }
+
+    let state = (data[0] ^ initial_seed) as u32;
+    // SAFETY: AVX2 presence checked above
+    let mut sum = unsafe { koopman16_avx2(&data[1..], state) };
+
+    // Append both implicit zero bytes in one step: 2^16 ≡ 17
+    sum = fast_mod_65519(sum * 17);
+
+    Some(sum as u16)
+}
+
+/// Advance a Koopman32 state across `body`, vectorizing whole 32-byte
+/// blocks and handling the tail with the scalar recurrence.
+///
+/// `state` is the Horner accumulator covering everything before `body`
+/// (already reduced mod 4294967291).
+#[target_feature(enable = "avx2")]
+unsafe fn koopman32_avx2(body: &[u8], state: u64) -> u64 {
+    let nblocks = body.len() / 32;
+
+    // Byte-swap control: make each 64-bit lane a big-endian word
+    let bswap = _mm256_setr_epi8(
+        7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8,
+        7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8,
+    );
+    let mask32 = _mm256_set1_epi64x(0xFFFF_FFFF);
+    let five = _mm256_set1_epi64x(5);
+    let k_block = _mm256_set1_epi64x(K32_BLOCK);
+    let m_minus_1 = _mm256_set1_epi64x((MODULUS_32 - 1) as i64);
+    let modulus = _mm256_set1_epi64x(MODULUS_32 as i64);
+
+    let mut acc = _mm256_setzero_si256();
+    let mut blocks = body.chunks_exact(32);
+    for block in blocks.by_ref() {
+        let w = _mm256_loadu_si256(block.as_ptr() as *const __m256i);
+        let w = _mm256_shuffle_epi8(w, bswap);
+        // Fold each word to < 6 * 2^32 using 2^32 ≡ 5
+        let folded = _mm256_add_epi64(
+            _mm256_mul_epu32(_mm256_srli_epi64(w, 32), five),
+            _mm256_and_si256(w, mask32),
+        );
+        // Horner step per lane: acc = acc * 256^32 + folded (< 2^51)
+        let t = _mm256_add_epi64(_mm256_mul_epu32(acc, k_block), folded);
+        // Reduce back below the modulus: one fold, one conditional subtract
+        let r = _mm256_add_epi64(
+            _mm256_mul_epu32(_mm256_srli_epi64(t, 32), five),
+            _mm256_and_si256(t, mask32),
+        );
+        let ge = _mm256_cmpgt_epi64(r, m_minus_1);
+        acc = _mm256_sub_epi64(r, _mm256_and_si256(ge, modulus));
+    }
+
+    let mut lanes = [0u64; 4];
+    _mm256_storeu_si256(lanes.as_mut_ptr() as *mut __m256i, acc);
+
+    // Merge: prior state is displaced by all vector-covered bytes, lane j
+    // carries weight 256^(8 * (3 - j))
+    let p = pow_256_mod(32 * nblocks, MODULUS_32);
+    let mut sum = ((state as u128 * p as u128
+        + lanes[0] as u128 * K32_LANE[0] as u128
+        + lanes[1] as u128 * K32_LANE[1] as u128
+        + lanes[2] as u128 * K32_LANE[2] as u128
+        + lanes[3] as u128)
+        % MODULUS_32 as u128) as u64;
+
+    // Tail bytes use the byte-at-a-time recurrence
+    for &byte in blocks.remainder() {
+        sum = fast_mod_4294967291((sum << 8) + byte as u64);
+    }
+    sum
+}
+
+/// Advance a Koopman16 state across `body`, vectorizing whole 32-byte
+/// blocks and handling the tail with the scalar recurrence.
+///
+/// `state` is the Horner accumulator covering everything before `body`
+/// (already reduced mod 65519).
+#[target_feature(enable = "avx2")]
+unsafe fn koopman16_avx2(body: &[u8], state: u32) -> u32 {
+    let nblocks = body.len() / 32;
+
+    let bswap = _mm256_setr_epi8(
+        7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8,
+        7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8,
+    );
+    let mask32 = _mm256_set1_epi64x(0xFFFF_FFFF);
+    let mask16 = _mm256_set1_epi32(0xFFFF);
+    let mask16_64 = _mm256_set1_epi64x(0xFFFF);
+    let seventeen = _mm256_set1_epi64x(17);
+    // Limb weights 17^k within each 64-bit word: even 32-bit halves hold
+    // limbs l0/l2 (weights 1, 17^2), odd halves l1/l3 (weights 17, 17^3)
+    let c_even = _mm256_set1_epi64x(((289i64) << 32) | 1);
+    let c_odd = _mm256_set1_epi64x(((4913i64) << 32) | 17);
+    let k_block = _mm256_set1_epi64x(K16_BLOCK);
+    let m_minus_1 = _mm256_set1_epi64x((MODULUS_16 - 1) as i64);
+    let modulus = _mm256_set1_epi64x(MODULUS_16 as i64);
+
+    let mut acc = _mm256_setzero_si256();
+    let mut blocks = body.chunks_exact(32);
+    for block in blocks.by_ref() {
+        let w = _mm256_loadu_si256(block.as_ptr() as *const __m256i);
+        let w = _mm256_shuffle_epi8(w, bswap);
+        // Fold the four 16-bit limbs of each word with weights 17^3..17^0,
+        // using 2^16 ≡ 17; per-32-bit sums stay under 2^31
+        let t = _mm256_add_epi32(
+            _mm256_mullo_epi32(_mm256_and_si256(w, mask16), c_even),
+            _mm256_mullo_epi32(_mm256_srli_epi32(w, 16), c_odd),
+        );
+        let folded = _mm256_add_epi64(_mm256_and_si256(t, mask32), _mm256_srli_epi64(t, 32));
+        // Horner step per lane: acc = acc * 256^32 + folded (< 2^32)
+        let t = _mm256_add_epi64(_mm256_mul_epu32(acc, k_block), folded);
+        // Reduce back below the modulus: two folds, one conditional subtract
+        let r = _mm256_add_epi64(
+            _mm256_mul_epu32(_mm256_srli_epi64(t, 16), seventeen),
+            _mm256_and_si256(t, mask16_64),
+        );
+        let r = _mm256_add_epi64(
+            _mm256_mul_epu32(_mm256_srli_epi64(r, 16), seventeen),
+            _mm256_and_si256(r, mask16_64),
+        );
+        let ge = _mm256_cmpgt_epi64(r, m_minus_1);
+        acc = _mm256_sub_epi64(r, _mm256_and_si256(ge, modulus));
+    }
+
+    let mut lanes = [0u64; 4];
+    _mm256_storeu_si256(lanes.as_mut_ptr() as *mut __m256i, acc);
+
+    let p = pow_256_mod(32 * nblocks, MODULUS_16 as u64);
+    let mut sum = ((state as u64 * p
+        + lanes[0] * K16_LANE[0]
+        + lanes[1] * K16_LANE[1]
+        + lanes[2] * K16_LANE[2]
+        + lanes[3])
+        % MODULUS_16 as u64) as u32;
+
+    for &byte in blocks.remainder() {
+        sum = fast_mod_65519((sum << 8) + byte as u32);
+    }
+    sum
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn test_simd_matches_scalar() {
+        // Cover the head byte, partial blocks, exact block multiples, and
+        // the tail at every offset
+        let data: Vec<u8> = (0..4096usize)
+            .map(|i| (i.wrapping_mul(31).wrapping_add(7)) as u8)
+            .collect();
+        for len in (0..=130).chain([255, 256, 257, 1024, 1500, 4095, 4096]) {
+            for seed in [0u8, 0xee] {
+                if let Some(cs) = koopman32(&data[..len], seed) {
+                    assert_eq!(cs, crate::koopman32(&data[..len], seed),
+                        "koopman32 mismatch at len {} seed {}", len, seed);
+                }
+                if let Some(cs) = koopman16(&data[..len], seed) {
+                    assert_eq!(cs, crate::koopman16(&data[..len], seed),
+                        "koopman16 mismatch at len {} seed {}", len, seed);
+                }
+            }
+        }
+    }
+}
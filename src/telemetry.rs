@@ -0,0 +1,148 @@
+//! Process-global telemetry counters (the `telemetry` feature).
+//!
+//! When enabled, every streaming-hasher `update` records a handful of
+//! relaxed atomic adds here — nothing enters the per-byte loops, so the
+//! cost is a few uncontended increments per call. The counters answer
+//! the capacity-planning questions the hot path otherwise hides: how
+//! many bytes flow through the hashers, in what chunk sizes, and
+//! whether they take the fast-modulus kernel or the generic Barrett
+//! path. Each hasher additionally keeps its own [`HasherStats`],
+//! readable through its `stats()` method.
+//!
+//! Counters are process-wide and monotonic; [`snapshot`] reads them at
+//! a point in time and rates are the difference of two snapshots.
+
+// Copyright (c) 2025 the koopman-checksum authors, all rights reserved.
+// See README.md for licensing information.
+
+use core::sync::atomic::{AtomicU64, Ordering};
+
+/// Upper bounds (inclusive, in bytes) of the first seven chunk-size
+/// histogram buckets; the eighth bucket is everything larger.
+pub const CHUNK_BUCKET_BOUNDS: [usize; 7] = [16, 64, 256, 1024, 4096, 65536, 1 << 20];
+
+const NUM_BUCKETS: usize = CHUNK_BUCKET_BOUNDS.len() + 1;
+
+static UPDATE_CALLS: AtomicU64 = AtomicU64::new(0);
+static BYTES: AtomicU64 = AtomicU64::new(0);
+static FAST_KERNEL_BYTES: AtomicU64 = AtomicU64::new(0);
+static GENERIC_KERNEL_BYTES: AtomicU64 = AtomicU64::new(0);
+static CHUNK_BUCKETS: [AtomicU64; NUM_BUCKETS] = [const { AtomicU64::new(0) }; NUM_BUCKETS];
+
+/// A point-in-time copy of the process-global counters.
+#[derive(Clone, Copy, Debug, Default, PartialEq, Eq)]
+pub struct Snapshot {
+    /// Streaming `update` calls across all hashers.
+    pub update_calls: u64,
+    /// Bytes fed to streaming `update` calls.
+    pub bytes: u64,
+    /// Bytes handled by the default-modulus fast-reduction kernels.
+    pub fast_kernel_bytes: u64,
+    /// Bytes handled by the generic Barrett path (custom moduli).
+    pub generic_kernel_bytes: u64,
+    /// Update-call counts by chunk size; bucket `i` holds calls of up
+    /// to [`CHUNK_BUCKET_BOUNDS`]`[i]` bytes, the last bucket the rest.
+    pub chunk_buckets: [u64; NUM_BUCKETS],
+}
+
+/// Per-hasher counters, embedded in each streaming hasher when the
+/// feature is enabled and read through its `stats()` method. Plain
+/// fields, not atomics: the hasher already requires `&mut self`.
+#[derive(Clone, Copy, Debug, Default, PartialEq, Eq)]
+pub struct HasherStats {
+    /// `update` calls on this hasher.
+    pub update_calls: u64,
+    /// Bytes fed to this hasher's `update`.
+    pub bytes: u64,
+}
+
+/// Read the process-global counters.
+#[must_use]
+pub fn snapshot() -> Snapshot {
+    Snapshot {
+        update_calls: UPDATE_CALLS.load(Ordering::Relaxed),
+        bytes: BYTES.load(Ordering::Relaxed),
+        fast_kernel_bytes: FAST_KERNEL_BYTES.load(Ordering::Relaxed),
+        generic_kernel_bytes: GENERIC_KERNEL_BYTES.load(Ordering::Relaxed),
+        chunk_buckets: core::array::from_fn(|i| CHUNK_BUCKETS[i].load(Ordering::Relaxed)),
+    }
+}
+
+/// Zero the process-global counters. Updates running concurrently land
+/// in whichever side of the reset they race with.
+pub fn reset() {
+    UPDATE_CALLS.store(0, Ordering::Relaxed);
+    BYTES.store(0, Ordering::Relaxed);
+    FAST_KERNEL_BYTES.store(0, Ordering::Relaxed);
+    GENERIC_KERNEL_BYTES.store(0, Ordering::Relaxed);
+    for bucket in &CHUNK_BUCKETS {
+        bucket.store(0, Ordering::Relaxed);
+    }
+}
+
+/// Record one streaming `update` call. Called once per update, never
+/// per byte.
+#[inline]
+pub(crate) fn record_update(len: usize, fast_kernel: bool) {
+    UPDATE_CALLS.fetch_add(1, Ordering::Relaxed);
+    BYTES.fetch_add(len as u64, Ordering::Relaxed);
+    if fast_kernel {
+        FAST_KERNEL_BYTES.fetch_add(len as u64, Ordering::Relaxed);
+    } else {
+        GENERIC_KERNEL_BYTES.fetch_add(len as u64, Ordering::Relaxed);
+    }
+    CHUNK_BUCKETS[bucket(len)].fetch_add(1, Ordering::Relaxed);
+}
+
+/// Histogram bucket for a chunk of `len` bytes.
+#[inline]
+fn bucket(len: usize) -> usize {
+    CHUNK_BUCKET_BOUNDS
+        .iter()
+        .position(|&bound| len <= bound)
+        .unwrap_or(NUM_BUCKETS - 1)
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn test_bucket_boundaries() {
+        assert_eq!(bucket(0), 0);
+        assert_eq!(bucket(16), 0);
+        assert_eq!(bucket(17), 1);
+        assert_eq!(bucket(65536), 5);
+        assert_eq!(bucket(1 << 20), 6);
+        assert_eq!(bucket((1 << 20) + 1), 7);
+    }
+
+    #[test]
+    fn test_counters_accumulate() {
+        // Other tests stream bytes concurrently, so assert on the delta
+        // this test contributes, not absolute values
+        let before = snapshot();
+
+        let mut hasher = crate::Koopman32::new();
+        hasher.update(&[0u8; 100]);
+        hasher.update(&[0u8; 5000]);
+        assert_eq!(
+            hasher.stats(),
+            HasherStats { update_calls: 2, bytes: 5100 }
+        );
+
+        let after = snapshot();
+        assert!(after.update_calls >= before.update_calls + 2);
+        assert!(after.bytes >= before.bytes + 5100);
+        assert!(after.fast_kernel_bytes >= before.fast_kernel_bytes + 5100);
+        // 100 bytes lands in the (64, 256] bucket, 5000 in (4096, 65536]
+        assert!(after.chunk_buckets[2] > before.chunk_buckets[2]);
+        assert!(after.chunk_buckets[5] > before.chunk_buckets[5]);
+
+        // A custom modulus routes through the generic-kernel counter
+        let modulus = core::num::NonZeroU64::new(2147483629).unwrap();
+        let mut hasher = crate::Koopman32::with_modulus(modulus);
+        hasher.update(&[0u8; 64]);
+        assert!(snapshot().generic_kernel_bytes >= before.generic_kernel_bytes + 64);
+    }
+}
@@ -0,0 +1,428 @@
+//! Exhaustive error-detection validation for custom moduli (the
+//! `validation` feature).
+//!
+//! `tests/hd_exhaustive.rs` qualifies the default moduli by corrupting a
+//! buffer and recomputing the checksum for every error pattern — at HD=4
+//! word counts that enumeration runs for days, so candidate moduli never
+//! get qualified at all. This module exploits the checksum's linearity
+//! instead: flipping bit `k` of byte `p` changes the finalized checksum
+//! by exactly `±2^k · 256^(len + 1 - p) mod m`, independent of every
+//! other byte. An undetected error pattern is therefore a set of per-bit
+//! deltas summing to zero mod m, which residue tables find without ever
+//! recomputing a checksum: every 2-bit pattern in O(n) lookups and every
+//! 3-bit pattern in O(n²) lookups across all cores, instead of O(n²) and
+//! O(n³) full checksum passes. Qualifying a candidate modulus becomes a
+//! routine run instead of a week-long enumeration.
+//!
+//! Two entry points:
+//!
+//! - [`find_undetected`] mirrors the exhaustive tests: given a concrete
+//!   data word and seed, search every 1/2/3-bit error pattern for one
+//!   the checksum misses. Any hit is confirmed by actually corrupting
+//!   the buffer and recomputing.
+//! - [`max_hd_length`] answers the qualification question directly: the
+//!   longest data word at which a modulus detects every 1-2 bit (HD=3)
+//!   or 1-3 bit (HD=4) error for *every* data word, seed, and checksum
+//!   corruption. It reproduces the published limits for the default
+//!   16-bit moduli (4092 bytes for 65519, 2044 for 32749).
+
+// Copyright (c) 2025 the koopman-checksum authors, all rights reserved.
+// See README.md for licensing information.
+
+use crate::{koopman16_with_modulus, pow_256_mod};
+use core::num::NonZeroU32;
+use std::collections::HashMap;
+use std::sync::atomic::{AtomicBool, Ordering};
+
+/// Per-bit checksum deltas for a concrete data word: entry `8p + k` is
+/// the (mod m) change to the finalized [`koopman16_with_modulus`]
+/// checksum when bit `k` of byte `p` flips. The sign of each delta
+/// follows from the byte's current bit value; the seed only matters
+/// through byte 0.
+fn bit_deltas(data: &[u8], seed: u8, m: u32) -> Vec<u32> {
+    let len = data.len();
+    let mut deltas = Vec::with_capacity(len * 8);
+    for (p, &byte) in data.iter().enumerate() {
+        let value = if p == 0 { byte ^ seed } else { byte };
+        // Byte p carries 256^(len - 1 - p) plus the two implicit zero
+        // bytes of finalization
+        let weight = pow_256_mod(len + 1 - p, m as u64);
+        for k in 0..8 {
+            let magnitude = ((1u64 << k) * weight % m as u64) as u32;
+            deltas.push(if value & (1 << k) != 0 {
+                // The bit clears: the checksum loses 2^k at this weight
+                (m - magnitude) % m
+            } else {
+                magnitude
+            });
+        }
+    }
+    deltas
+}
+
+/// Map each delta residue to the (ascending) bit indices that produce it.
+fn residue_index(deltas: &[u32]) -> HashMap<u32, Vec<u32>> {
+    let mut index: HashMap<u32, Vec<u32>> = HashMap::with_capacity(deltas.len());
+    for (i, &d) in deltas.iter().enumerate() {
+        index.entry(d).or_default().push(i as u32);
+    }
+    index
+}
+
+/// Split `0..n` into per-thread ranges and run `work` on each,
+/// returning the first `Some` any thread produced. `work` should poll
+/// the flag and give up once another thread has found a hit.
+fn parallel_find<T, F>(n: usize, work: F) -> Option<T>
+where
+    T: Send,
+    F: Fn(core::ops::Range<usize>, &AtomicBool) -> Option<T> + Sync,
+{
+    let threads = std::thread::available_parallelism().map_or(1, |t| t.get()).min(n.max(1));
+    let chunk = n.div_ceil(threads);
+    let found = AtomicBool::new(false);
+
+    std::thread::scope(|scope| {
+        let handles: Vec<_> = (0..threads)
+            .map(|t| {
+                let range = t * chunk..((t + 1) * chunk).min(n);
+                let (work, found) = (&work, &found);
+                scope.spawn(move || {
+                    let hit = work(range, found);
+                    if hit.is_some() {
+                        found.store(true, Ordering::Relaxed);
+                    }
+                    hit
+                })
+            })
+            .collect();
+        handles.into_iter().filter_map(|h| h.join().unwrap()).next()
+    })
+}
+
+/// Search every error pattern of up to `max_bits` bits (1 to 3) for one
+/// that [`koopman16_with_modulus`] fails to detect on this data word
+/// and seed.
+///
+/// Returns the bit positions of the first undetected pattern found
+/// (ascending, bit `i` being bit `i % 8` of byte `i / 8`), or `None`
+/// when every pattern is detected. A hit is confirmed by corrupting the
+/// buffer and recomputing before it is returned.
+///
+/// Covers the same search space as the exhaustive corruption tests but
+/// through the per-bit delta table, so the 2-bit sweep is O(n) and the
+/// 3-bit sweep O(n²) table lookups spread across all cores — not O(n²)
+/// and O(n³) checksum recomputations.
+///
+/// # Example
+/// ```rust
+/// use core::num::NonZeroU32;
+/// use koopman_checksum::validation::find_undetected;
+/// use koopman_checksum::MODULUS_16;
+///
+/// let data = vec![0u8; 512];
+/// let modulus = NonZeroU32::new(MODULUS_16).unwrap();
+/// // HD=3 holds well inside the 4092-byte limit
+/// assert_eq!(find_undetected(&data, 0, modulus, 2), None);
+/// ```
+///
+/// # Panics
+/// Panics if `max_bits` is outside 1 to 3.
+#[must_use]
+pub fn find_undetected(
+    data: &[u8],
+    seed: u8,
+    modulus: NonZeroU32,
+    max_bits: usize,
+) -> Option<Vec<usize>> {
+    assert!(
+        (1..=3).contains(&max_bits),
+        "max_bits must be 1, 2, or 3"
+    );
+    let m = modulus.get();
+    let deltas = bit_deltas(data, seed, m);
+    let n = deltas.len();
+
+    // 1-bit: a delta of zero leaves the checksum unchanged on its own
+    if let Some(i) = deltas.iter().position(|&d| d == 0) {
+        return Some(confirm(data, seed, modulus, vec![i]));
+    }
+    if max_bits == 1 {
+        return None;
+    }
+
+    let index = residue_index(&deltas);
+
+    // 2-bit: deltas cancel pairwise
+    for (i, &d) in deltas.iter().enumerate() {
+        if let Some(later) = first_index_above(&index, (m - d) % m, i) {
+            return Some(confirm(data, seed, modulus, vec![i, later]));
+        }
+    }
+    if max_bits == 2 {
+        return None;
+    }
+
+    // 3-bit: for each pair, look up the one delta that would cancel it.
+    // The pair loop is the O(n²) part, so it gets the threads
+    parallel_find(n, |range, found| {
+        for i in range {
+            if found.load(Ordering::Relaxed) {
+                return None;
+            }
+            for j in i + 1..n {
+                let want = ((m - deltas[i]) as u64 + (m - deltas[j]) as u64) % m as u64;
+                if let Some(k) = first_index_above(&index, want as u32, j) {
+                    return Some((i, j, k));
+                }
+            }
+        }
+        None
+    })
+    .map(|(i, j, k)| confirm(data, seed, modulus, vec![i, j, k]))
+}
+
+/// First bit index strictly above `after` whose delta equals `residue`.
+#[inline]
+fn first_index_above(index: &HashMap<u32, Vec<u32>>, residue: u32, after: usize) -> Option<usize> {
+    let indices = index.get(&residue)?;
+    let pos = indices.partition_point(|&i| i as usize <= after);
+    indices.get(pos).map(|&i| i as usize)
+}
+
+/// Corrupt `data` at `bits` and check that the checksum really does
+/// collide — a guard on the delta arithmetic, not part of the search.
+fn confirm(data: &[u8], seed: u8, modulus: NonZeroU32, bits: Vec<usize>) -> Vec<usize> {
+    let mut corrupted = data.to_vec();
+    for &bit in &bits {
+        corrupted[bit / 8] ^= 1 << (bit % 8);
+    }
+    assert_eq!(
+        koopman16_with_modulus(&corrupted, seed, modulus),
+        koopman16_with_modulus(data, seed, modulus),
+        "delta search reported bits {:?} but the checksums differ",
+        bits
+    );
+    bits
+}
+
+/// The longest data word (in bytes, up to `limit`) at which a modulus
+/// holds the requested Hamming distance for *every* data word, seed,
+/// and error placement — including errors in the `checksum_bits`-bit
+/// stored check value itself.
+///
+/// `hd` is 3 (all 1-2 bit errors detected) or 4 (all 1-3 bit errors).
+/// Returns 0 when even a 1-byte word can be defeated. For a parity
+/// variant, qualify its modular part with `hd = 3`: the parity bit
+/// already catches every odd-weight error, so only the even-weight
+/// patterns fall to the modular sum.
+///
+/// Works on delta magnitudes alone: any data word can realize either
+/// sign of a bit's delta, so an undetectable pattern exists exactly
+/// when some signed combination of distinct magnitudes cancels mod m.
+/// A defeating pattern at one length persists at the next (every
+/// magnitude scales by 256), so the search bisects over lengths; each
+/// HD=3 probe costs O(n) lookups, each HD=4 probe O(n²) across all
+/// cores.
+///
+/// Reproduces the published limits for the default 16-bit moduli:
+///
+/// ```rust
+/// use core::num::NonZeroU32;
+/// use koopman_checksum::validation::max_hd_length;
+/// use koopman_checksum::{MODULUS_15P, MODULUS_16};
+///
+/// let m16 = NonZeroU32::new(MODULUS_16).unwrap();
+/// assert_eq!(max_hd_length(m16, 16, 3, 8192), 4092);
+///
+/// let m15 = NonZeroU32::new(MODULUS_15P).unwrap();
+/// assert_eq!(max_hd_length(m15, 15, 3, 8192), 2044);
+/// ```
+///
+/// Being data- and seed-independent, this is stricter than the
+/// fixed-pattern exhaustive tests; for the 8-bit family it reports
+/// shorter limits than the per-pattern tables, consistent with the
+/// known counterexamples against those claims.
+///
+/// # Panics
+/// Panics if `hd` is not 3 or 4, or `checksum_bits` exceeds 32.
+#[must_use]
+pub fn max_hd_length(modulus: NonZeroU32, checksum_bits: u32, hd: u32, limit: usize) -> usize {
+    assert!(hd == 3 || hd == 4, "hd must be 3 or 4");
+    assert!(checksum_bits <= 32, "checksum_bits must be at most 32");
+    let m = modulus.get();
+
+    // Smallest defeated length in [1, limit + 1], bisected on the
+    // monotonicity argument above; limit + 1 stands for "none found"
+    let (mut lo, mut hi) = (1usize, limit + 1);
+    while lo < hi {
+        let mid = lo + (hi - lo) / 2;
+        if probe(m, checksum_bits, hd, mid) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    lo - 1
+}
+
+/// Whether every pattern of up to `hd - 1` signed magnitudes is
+/// detected at data length `len`.
+fn probe(m: u32, checksum_bits: u32, hd: u32, len: usize) -> bool {
+    // Delta magnitudes: data bit k of byte p weighs 2^k · 256^(len+1-p);
+    // a flipped bit of the stored check value weighs 2^k directly
+    let mut magnitudes: Vec<u32> = (0..checksum_bits).map(|k| (1u64 << k) as u32 % m).collect();
+    for p in 0..len {
+        let weight = pow_256_mod(len + 1 - p, m as u64);
+        for k in 0..8 {
+            magnitudes.push(((1u64 << k) * weight % m as u64) as u32);
+        }
+    }
+
+    // Singles and pairs: a zero magnitude, two equal magnitudes (one
+    // flip up, one down), or two summing to m all cancel
+    let counts: HashMap<u32, u32> = {
+        let mut counts = HashMap::with_capacity(magnitudes.len());
+        for &u in &magnitudes {
+            *counts.entry(u).or_insert(0u32) += 1;
+        }
+        counts
+    };
+    for (&u, &count) in &counts {
+        if u == 0 || count > 1 || 2 * u as u64 == m as u64 {
+            return false;
+        }
+        if u < m - u && counts.contains_key(&(m - u)) {
+            return false;
+        }
+    }
+    if hd == 3 {
+        return true;
+    }
+
+    // Triples: up to global negation, three distinct magnitudes cancel
+    // as a + b + c ≡ 0 or a + b ≡ c (in any role assignment), so for
+    // each pair the candidate thirds are -(a+b), a+b, a-b, and b-a
+    let n = magnitudes.len();
+    let has_third = |residue: u32, a: u32, b: u32| {
+        // Every magnitude is unique here (count > 1 failed above), so
+        // excluding the pair itself is a value comparison
+        residue != a && residue != b && counts.contains_key(&residue)
+    };
+    parallel_find(n, |range, found| {
+        for i in range {
+            if found.load(Ordering::Relaxed) {
+                return None;
+            }
+            let a = magnitudes[i];
+            for &b in &magnitudes[i + 1..] {
+                let sum = ((a as u64 + b as u64) % m as u64) as u32;
+                if has_third((m - sum) % m, a, b)
+                    || has_third(sum, a, b)
+                    || has_third((m + a - b) % m, a, b)
+                    || has_third((m + b - a) % m, a, b)
+                {
+                    return Some(());
+                }
+            }
+        }
+        None
+    })
+    .is_none()
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    /// Recompute-everything reference search, the shape the exhaustive
+    /// tests use.
+    fn brute_force(data: &[u8], seed: u8, modulus: NonZeroU32, max_bits: usize) -> bool {
+        let original = koopman16_with_modulus(data, seed, modulus);
+        let n = data.len() * 8;
+        let hit = |bits: &[usize]| {
+            let mut corrupted = data.to_vec();
+            for &bit in bits {
+                corrupted[bit / 8] ^= 1 << (bit % 8);
+            }
+            koopman16_with_modulus(&corrupted, seed, modulus) == original
+        };
+        for i in 0..n {
+            if hit(&[i]) {
+                return true;
+            }
+            if max_bits < 2 {
+                continue;
+            }
+            for j in i + 1..n {
+                if hit(&[i, j]) {
+                    return true;
+                }
+                if max_bits < 3 {
+                    continue;
+                }
+                for k in j + 1..n {
+                    if hit(&[i, j, k]) {
+                        return true;
+                    }
+                }
+            }
+        }
+        false
+    }
+
+    #[test]
+    fn test_find_undetected_matches_brute_force() {
+        // Small words where the O(n³) reference is affordable; moduli
+        // chosen small enough that collisions actually occur
+        let pattern: Vec<u8> = (0..6).map(|i| (i * 7 + 13) as u8).collect();
+        for modulus in [125u32, 251, 1021, 32749] {
+            let modulus = NonZeroU32::new(modulus).unwrap();
+            for data in [&vec![0u8; 6], &pattern] {
+                for seed in [0u8, 0xee] {
+                    for max_bits in 1..=3 {
+                        let found = find_undetected(data, seed, modulus, max_bits);
+                        assert_eq!(
+                            found.is_some(),
+                            brute_force(data, seed, modulus, max_bits),
+                            "modulus {} seed {} max_bits {}",
+                            modulus,
+                            seed,
+                            max_bits
+                        );
+                        // find_undetected confirms its own hits by
+                        // recomputation, so Some is already validated
+                        if let Some(bits) = found {
+                            assert!(bits.len() <= max_bits);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    #[test]
+    fn test_default_modulus_holds_hd3_in_range() {
+        let modulus = NonZeroU32::new(crate::MODULUS_16).unwrap();
+        let pattern: Vec<u8> = (0..256).map(|i| (i * 7 + 13) as u8).collect();
+        for data in [&vec![0u8; 256], &pattern] {
+            assert_eq!(find_undetected(data, 0xee, modulus, 2), None);
+        }
+    }
+
+    #[test]
+    fn test_max_hd_length_reproduces_published_bounds() {
+        let m16 = NonZeroU32::new(crate::MODULUS_16).unwrap();
+        assert_eq!(max_hd_length(m16, 16, 3, 8192), 4092);
+
+        let m15 = NonZeroU32::new(crate::MODULUS_15P).unwrap();
+        assert_eq!(max_hd_length(m15, 15, 3, 8192), 2044);
+
+        // Plain HD=4 falls apart immediately at 16 bits: 1 + 2^4 ≡ 2^16
+        // (mod 65519) is a 3-bit pattern across data and check value
+        assert_eq!(max_hd_length(m16, 16, 4, 64), 0);
+        assert_eq!(max_hd_length(m15, 15, 4, 64), 11);
+
+        // The limit caps the search when no defeating pattern is found
+        assert_eq!(max_hd_length(m16, 16, 3, 100), 100);
+    }
+}